@@ -0,0 +1,117 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_BENCHMARKS_HARNESS_H_
+#define ABULAFIA_BENCHMARKS_HARNESS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Incremented by the global operator new replacement in main.cpp.
+extern std::size_t allocation_count;
+
+// A chunk of input, along with the number of tokens it holds. What counts as
+// a token is up to each workload, but stays the same between runs.
+struct Workload {
+  std::string name;
+  std::string data;
+  std::size_t tokens = 0;
+};
+
+struct Measurement {
+  std::string name;
+  double mb_per_s;
+  double ns_per_token;
+  double allocs_per_parse;
+};
+
+class Runner {
+ public:
+  Runner(int argc, char const* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg.compare(0, 11, "--min-time=") == 0) {
+        min_time_ = std::atof(arg.c_str() + 11);
+      } else if (arg == "--csv") {
+        csv_ = true;
+      } else {
+        filter_ = arg;
+      }
+    }
+  }
+
+  // Runs parse_once() until at least min_time seconds have elapsed.
+  // parse_once() must return true when the parse succeeded.
+  template <typename F>
+  void run(std::string const& mode, Workload const& w, F&& parse_once) {
+    std::string name = w.name + "/" + mode;
+    if (!filter_.empty() && name.find(filter_) == std::string::npos) {
+      return;
+    }
+
+    if (!parse_once()) {
+      std::fprintf(stderr, "%s: parse failed\n", name.c_str());
+      std::exit(1);
+    }
+
+    using clock = std::chrono::steady_clock;
+    std::size_t iterations = 1;
+    while (true) {
+      std::size_t allocs_before = allocation_count;
+      auto start = clock::now();
+      for (std::size_t i = 0; i < iterations; ++i) {
+        parse_once();
+      }
+      std::chrono::duration<double> elapsed = clock::now() - start;
+      std::size_t allocs = allocation_count - allocs_before;
+
+      if (elapsed.count() >= min_time_) {
+        double per_parse = elapsed.count() / double(iterations);
+        results_.push_back(
+            {name, double(w.data.size()) / per_parse / 1e6,
+             per_parse * 1e9 / double(w.tokens),
+             double(allocs) / double(iterations)});
+        return;
+      }
+      iterations *= 2;
+    }
+  }
+
+  void report() const {
+    if (csv_) {
+      std::printf("benchmark,MB/s,ns/token,allocs/parse\n");
+      for (auto const& r : results_) {
+        std::printf("%s,%.2f,%.2f,%.1f\n", r.name.c_str(), r.mb_per_s,
+                    r.ns_per_token, r.allocs_per_parse);
+      }
+      return;
+    }
+
+    std::printf("%-32s %12s %12s %14s\n", "benchmark", "MB/s", "ns/token",
+                "allocs/parse");
+    for (auto const& r : results_) {
+      std::printf("%-32s %12.2f %12.2f %14.1f\n", r.name.c_str(), r.mb_per_s,
+                  r.ns_per_token, r.allocs_per_parse);
+    }
+  }
+
+ private:
+  std::string filter_;
+  double min_time_ = 0.25;
+  bool csv_ = false;
+  std::vector<Measurement> results_;
+};
+
+}  // namespace bench
+
+#endif
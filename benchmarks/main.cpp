@@ -0,0 +1,350 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "expr_pattern.h"
+
+#include "harness.h"
+#include "workloads.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// Usage: abulafia_benchmarks [filter] [--min-time=seconds] [--csv]
+//
+// Every workload is parsed in one go through abu::parse(), then fed through
+// make_parser() in chunks of various sizes.
+
+namespace bench {
+std::size_t allocation_count = 0;
+}
+
+// Every form of new and delete goes through these two, so that all
+// allocations get counted, and that memory is always given back the same
+// way it was obtained.
+namespace {
+void* counted_allocate(std::size_t size, std::size_t align) noexcept {
+  ++bench::allocation_count;
+  align = std::max(align, alignof(std::max_align_t));
+  size = (std::max(size, std::size_t(1)) + align - 1) / align * align;
+#ifdef _WIN32
+  return _aligned_malloc(size, align);
+#else
+  return std::aligned_alloc(align, size);
+#endif
+}
+
+void counted_free(void* p) noexcept {
+#ifdef _WIN32
+  _aligned_free(p);
+#else
+  std::free(p);
+#endif
+}
+
+void* counted_new(std::size_t size, std::size_t align) {
+  if (void* p = counted_allocate(size, align)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return counted_new(size, alignof(std::max_align_t));
+}
+void* operator new[](std::size_t size) {
+  return counted_new(size, alignof(std::max_align_t));
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+  return counted_new(size, std::size_t(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+  return counted_new(size, std::size_t(align));
+}
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+  return counted_allocate(size, alignof(std::max_align_t));
+}
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept {
+  return counted_allocate(size, alignof(std::max_align_t));
+}
+void* operator new(std::size_t size, std::align_val_t align,
+                   std::nothrow_t const&) noexcept {
+  return counted_allocate(size, std::size_t(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align,
+                     std::nothrow_t const&) noexcept {
+  return counted_allocate(size, std::size_t(align));
+}
+
+void operator delete(void* p) noexcept { counted_free(p); }
+void operator delete[](void* p) noexcept { counted_free(p); }
+void operator delete(void* p, std::size_t) noexcept { counted_free(p); }
+void operator delete[](void* p, std::size_t) noexcept { counted_free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept {
+  counted_free(p);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  counted_free(p);
+}
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+  counted_free(p);
+}
+void operator delete(void* p, std::nothrow_t const&) noexcept {
+  counted_free(p);
+}
+void operator delete[](void* p, std::nothrow_t const&) noexcept {
+  counted_free(p);
+}
+void operator delete(void* p, std::align_val_t,
+                     std::nothrow_t const&) noexcept {
+  counted_free(p);
+}
+void operator delete[](void* p, std::align_val_t,
+                       std::nothrow_t const&) noexcept {
+  counted_free(p);
+}
+
+namespace {
+
+constexpr std::size_t chunk_sizes[] = {16, 256, 4096};
+
+template <typename DATASOURCE_T, typename PAT_T, typename DST_T>
+bool parse_chunked(std::string const& data, std::size_t chunk_size,
+                   PAT_T const& pat, DST_T& dst) {
+  auto parser = abu::make_parser<DATASOURCE_T>(pat, dst);
+  std::string_view view(data);
+
+  abu::Result status = abu::Result::PARTIAL;
+  for (std::size_t i = 0; i < view.size() && status == abu::Result::PARTIAL;
+       i += chunk_size) {
+    parser.data().add_buffer(view.substr(i, chunk_size));
+    status = parser.consume();
+  }
+
+  if (status == abu::Result::PARTIAL) {
+    parser.data().add_buffer(std::string_view(), abu::IsFinal::FINAL);
+    status = parser.consume();
+  }
+  return status == abu::Result::SUCCESS;
+}
+
+// Runs a workload through parse() and make_parser().
+// DST_T is default-constructed anew for every parse.
+template <typename DST_T, typename PAT_T>
+void run_all_modes(bench::Runner& runner, bench::Workload const& w,
+                   PAT_T const& pat) {
+  runner.run("parse", w, [&] {
+    DST_T dst{};
+    return abu::parse(w.data.begin(), w.data.end(), pat, dst) ==
+           abu::Result::SUCCESS;
+  });
+
+  for (auto chunk_size : chunk_sizes) {
+    runner.run("chunked_" + std::to_string(chunk_size), w, [&] {
+      DST_T dst{};
+      return parse_chunked<std::string_view>(w.data, chunk_size, pat, dst);
+    });
+  }
+}
+
+// Data sources that only make sense for flat, record-like inputs.
+template <typename DST_T, typename PAT_T>
+void run_record_modes(bench::Runner& runner, bench::Workload const& w,
+                      PAT_T const& pat) {
+  runner.run("ring_4096", w, [&] {
+    DST_T dst{};
+    return parse_chunked<abu::ContainerRingDataSource<std::string_view>>(
+        w.data, 4096, pat, dst);
+  });
+
+  auto path = std::filesystem::temp_directory_path() /
+              ("abulafia_bench_" + w.name + ".txt");
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << w.data;
+  }
+  runner.run("mapped_file", w, [&] {
+    DST_T dst{};
+    return abu::parse_file(path.string(), pat, dst) == abu::Result::SUCCESS;
+  });
+  std::filesystem::remove(path);
+}
+
+}  // namespace
+
+int main(int argc, char const* argv[]) {
+  bench::Runner runner(argc, argv);
+
+  auto digit = abu::char_set::range('0', '9');
+  auto alpha = abu::char_set::range('a', 'z');
+
+  // CSV
+  {
+    auto w = bench::make_csv(20000);
+    auto row = abu::uint_ >> ',' >> +abu::char_(alpha) >> ',' >> abu::int_ >>
+               ',' >> +abu::char_(digit) >> '.' >> +abu::char_(digit) >> '\n';
+    auto pat = *row;
+    run_all_modes<abu::Nil>(runner, w, pat);
+    run_record_modes<abu::Nil>(runner, w, pat);
+  }
+
+  // JSON-like
+  {
+    auto w = bench::make_json(2000);
+    abu::RecurMemoryPool pool;
+    abu::Recur<struct json_value_t> value(pool);
+
+    auto str = abu::lexeme('"' >> *abu::char_(~abu::char_set::single('"')) >>
+                           '"');
+    auto array = '[' >> -(value % ',') >> ']';
+    auto member = str >> ':' >> value;
+    auto object = '{' >> -(member % ',') >> '}';
+    auto json_pat = abu::double_ | str | array | object | abu::lit("true") |
+                    abu::lit("false") | abu::lit("null");
+    ABU_Recur_define(value, json_value_t, json_pat);
+
+    auto pat = abu::apply_skipper(value, abu::char_(" \n"));
+    run_all_modes<abu::Nil>(runner, w, pat);
+  }
+
+  // Arithmetic expressions, evaluated while parsing.
+  {
+    auto w = bench::make_expressions(10000);
+    abu::RecurMemoryPool pool;
+    auto pat = *(make_expr_pattern(pool) >> '\n');
+    run_all_modes<std::vector<int>>(runner, w, pat);
+  }
+
+  // Numeric lists.
+  {
+    auto w = bench::make_uint_list(100000);
+    auto pat = abu::uint_ % ',';
+    run_all_modes<std::vector<std::uint32_t>>(runner, w, pat);
+    run_record_modes<std::vector<std::uint32_t>>(runner, w, pat);
+  }
+  {
+    auto w = bench::make_double_list(100000);
+    auto pat = abu::double_ % ',';
+    run_all_modes<std::vector<double>>(runner, w, pat);
+    run_record_modes<std::vector<double>>(runner, w, pat);
+  }
+
+  // Repeated sequence, with a fresh child parser for every element.
+  {
+    auto w = bench::make_tagged_values(1000000);
+    auto pat = *(abu::char_(alpha) >> abu::uint_ >> ';');
+    run_all_modes<abu::Nil>(runner, w, pat);
+  }
+
+  // Character runs.
+  {
+    auto w = bench::make_identifiers(100000);
+    auto pat = +abu::char_(alpha) % ' ';
+    run_all_modes<abu::Nil>(runner, w, pat);
+  }
+
+  // Wide alternative, resolved on the first character.
+  {
+    auto w = bench::make_statements(100000);
+    auto const& k = bench::statement_keys();
+    auto stmt = [&](std::size_t i) { return abu::lit(k[i].c_str()) >> ' '; };
+    auto pat = *((stmt(0) | stmt(1) | stmt(2) | stmt(3) | stmt(4) | stmt(5) |
+                  stmt(6) | stmt(7) | stmt(8) | stmt(9) | stmt(10) | stmt(11) |
+                  stmt(12) | stmt(13) | stmt(14) | stmt(15)) >>
+                 abu::uint_ >> '\n');
+    run_all_modes<abu::Nil>(runner, w, pat);
+
+    // Same grammar, with each keyword and its trailing space fused.
+    w.name = "statements_optimized";
+    run_all_modes<abu::Nil>(runner, w, abu::optimize(pat));
+
+    // Same data, tokenized by a lexer first.
+    enum { KEY, NUMBER, EOL };
+    auto lexer = abu::LexerBuilder<>()
+                     .add(KEY, +abu::char_(alpha))
+                     .add(NUMBER, +abu::char_(digit))
+                     .add(EOL, '\n')
+                     .skip(' ')
+                     .build();
+    auto tok_pat = *(abu::tok(KEY) >> abu::tok(NUMBER) >> abu::tok(EOL));
+
+    w.name = "statements_lexed";
+    std::vector<abu::Token<>> tokens;
+    runner.run("lex", w, [&] {
+      tokens.clear();
+      return lexer.tokenize(w.data, tokens) == abu::Result::SUCCESS;
+    });
+    runner.run("lex_parse", w, [&] {
+      tokens.clear();
+      return lexer.tokenize(w.data, tokens) == abu::Result::SUCCESS &&
+             abu::parse(tokens.begin(), tokens.end(), tok_pat) ==
+                 abu::Result::SUCCESS;
+    });
+  }
+
+  // Keyword lookup.
+  {
+    auto w = bench::make_keywords(2048, 100000);
+    auto pat = abu::symbol(w.keywords) % ' ';
+    run_all_modes<std::vector<int>>(runner, w, pat);
+
+    w.name = "keywords_hashed";
+    auto hashed_pat = abu::symbol_hashed(w.keywords, ' ') % ' ';
+    run_all_modes<std::vector<int>>(runner, w, hashed_pat);
+
+    // One tiny input per keyword.
+    std::vector<std::string_view> messages;
+    std::string_view view(w.data);
+    for (std::size_t i = 0; i <= view.size();) {
+      auto end = std::min(view.find(' ', i), view.size());
+      messages.push_back(view.substr(i, end - i));
+      i = end + 1;
+    }
+
+    w.name = "keyword_messages";
+    auto msg_pat = abu::symbol(w.keywords);
+    runner.run("parse", w, [&] {
+      for (auto msg : messages) {
+        int dst;
+        if (abu::parse(msg.begin(), msg.end(), msg_pat, dst) !=
+            abu::Result::SUCCESS) {
+          return false;
+        }
+      }
+      return true;
+    });
+
+    auto reusable = abu::make_reusable_parser<int>(msg_pat);
+    runner.run("reusable", w, [&] {
+      for (auto msg : messages) {
+        int dst;
+        if (reusable.parse(msg.begin(), msg.end(), dst) !=
+            abu::Result::SUCCESS) {
+          return false;
+        }
+      }
+      return true;
+    });
+  }
+
+  runner.report();
+  return 0;
+}
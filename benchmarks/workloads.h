@@ -0,0 +1,277 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_BENCHMARKS_WORKLOADS_H_
+#define ABULAFIA_BENCHMARKS_WORKLOADS_H_
+
+#include "harness.h"
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Every workload is generated from a fixed seed, and only uses the raw output
+// of std::mt19937 (which is fully specified), so the data is identical on
+// every platform.
+namespace bench {
+
+class Generator {
+ public:
+  explicit Generator(std::uint32_t seed) : rng_(seed) {}
+
+  // Uniform-ish in [lo, hi]
+  std::uint32_t between(std::uint32_t lo, std::uint32_t hi) {
+    return lo + std::uint32_t(rng_() % (std::uint64_t(hi) - lo + 1));
+  }
+
+  std::string word(std::size_t min_len, std::size_t max_len) {
+    std::string result;
+    auto len = between(std::uint32_t(min_len), std::uint32_t(max_len));
+    for (std::size_t i = 0; i < len; ++i) {
+      result.push_back(char('a' + between(0, 25)));
+    }
+    return result;
+  }
+
+ private:
+  std::mt19937 rng_;
+};
+
+// id,name,score,ratio
+// One token per field.
+inline Workload make_csv(std::size_t rows) {
+  Generator gen(1);
+  Workload w{"csv", "", 0};
+  for (std::size_t i = 0; i < rows; ++i) {
+    w.data += std::to_string(i) + ',';
+    w.data += gen.word(3, 12) + ',';
+    w.data += std::to_string(int(gen.between(0, 200000)) - 100000) + ',';
+    w.data += std::to_string(gen.between(0, 99999)) + '.' +
+              std::to_string(gen.between(0, 999)) + '\n';
+    w.tokens += 4;
+  }
+  return w;
+}
+
+namespace detail {
+inline void json_value(Generator& gen, Workload& w, int depth) {
+  auto kind = gen.between(0, depth >= 4 ? 3 : 5);
+  ++w.tokens;
+  switch (kind) {
+    case 0:
+      w.data += std::to_string(gen.between(0, 1000000));
+      break;
+    case 1:
+      w.data += std::to_string(gen.between(0, 9999)) + '.' +
+                std::to_string(gen.between(0, 99)) + "e-" +
+                std::to_string(gen.between(0, 20));
+      break;
+    case 2:
+      w.data += '"' + gen.word(0, 16) + '"';
+      break;
+    case 3:
+      w.data += gen.between(0, 1) ? "true" : "null";
+      break;
+    case 4: {
+      w.data += '[';
+      auto n = gen.between(0, 6);
+      for (std::uint32_t i = 0; i < n; ++i) {
+        if (i) {
+          w.data += ", ";
+        }
+        json_value(gen, w, depth + 1);
+      }
+      w.data += ']';
+    } break;
+    default: {
+      w.data += "{\n";
+      auto n = gen.between(0, 6);
+      for (std::uint32_t i = 0; i < n; ++i) {
+        if (i) {
+          w.data += ",\n";
+        }
+        w.data += "  \"" + gen.word(1, 10) + "\": ";
+        ++w.tokens;
+        json_value(gen, w, depth + 1);
+      }
+      w.data += "\n}";
+    } break;
+  }
+}
+}  // namespace detail
+
+// A single array of JSON-like documents.
+// One token per value and per object key.
+inline Workload make_json(std::size_t documents) {
+  Generator gen(2);
+  Workload w{"json", "[", 0};
+  for (std::size_t i = 0; i < documents; ++i) {
+    if (i) {
+      w.data += ",\n";
+    }
+    detail::json_value(gen, w, 0);
+  }
+  w.data += "]";
+  return w;
+}
+
+namespace detail {
+// Values are kept small enough that evaluating them fits in an int.
+inline void expr(Generator& gen, Workload& w, bool allow_parens) {
+  auto terms = gen.between(1, 4);
+  for (std::uint32_t t = 0; t < terms; ++t) {
+    if (t) {
+      w.data += gen.between(0, 1) ? " + " : " - ";
+      ++w.tokens;
+    }
+
+    if (allow_parens && gen.between(0, 3) == 0) {
+      w.data += '(';
+      expr(gen, w, false);
+      w.data += ')';
+      w.tokens += 2;
+    } else {
+      w.data += std::to_string(gen.between(1, 999));
+      ++w.tokens;
+    }
+
+    auto factors = gen.between(0, 2);
+    for (std::uint32_t f = 0; f < factors; ++f) {
+      w.data += gen.between(0, 1) ? " * " : " / ";
+      w.data += std::to_string(gen.between(1, 9));
+      w.tokens += 2;
+    }
+  }
+}
+}  // namespace detail
+
+// One arithmetic expression per line.
+// One token per number, operator and parenthesis.
+inline Workload make_expressions(std::size_t lines) {
+  Generator gen(3);
+  Workload w{"expr", "", 0};
+  for (std::size_t i = 0; i < lines; ++i) {
+    detail::expr(gen, w, true);
+    w.data += '\n';
+  }
+  return w;
+}
+
+// Comma-separated unsigned integers, one token per value.
+inline Workload make_uint_list(std::size_t count) {
+  Generator gen(4);
+  Workload w{"uint_list", "", count};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i) {
+      w.data += ',';
+    }
+    w.data += std::to_string(gen.between(0, 0xFFFFFFFF) >> gen.between(0, 31));
+  }
+  return w;
+}
+
+// Comma-separated floating point values, one token per value.
+inline Workload make_double_list(std::size_t count) {
+  Generator gen(5);
+  Workload w{"double_list", "", count};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i) {
+      w.data += ',';
+    }
+    if (gen.between(0, 1)) {
+      w.data += '-';
+    }
+    w.data += std::to_string(gen.between(0, 99999)) + '.' +
+              std::to_string(gen.between(0, 999999999));
+    if (gen.between(0, 3) == 0) {
+      w.data += 'e' + std::to_string(int(gen.between(0, 40)) - 20);
+    }
+  }
+  return w;
+}
+
+// A letter followed by a number and a semicolon, with no separators. One
+// token per element.
+inline Workload make_tagged_values(std::size_t count) {
+  Generator gen(9);
+  Workload w{"tagged", "", count};
+  for (std::size_t i = 0; i < count; ++i) {
+    w.data += char('a' + gen.between(0, 25));
+    w.data += std::to_string(gen.between(0, 9999)) + ';';
+  }
+  return w;
+}
+
+// Space-separated identifiers, one token per identifier.
+inline Workload make_identifiers(std::size_t count) {
+  Generator gen(6);
+  Workload w{"identifiers", "", count};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i) {
+      w.data += ' ';
+    }
+    w.data += gen.word(1, 24);
+  }
+  return w;
+}
+
+// A table of keywords, and a space-separated sequence of them.
+// One token per keyword.
+struct KeywordWorkload : Workload {
+  std::map<std::string, int> keywords;
+};
+
+inline KeywordWorkload make_keywords(std::size_t table_size,
+                                     std::size_t count) {
+  Generator gen(7);
+  KeywordWorkload w;
+  w.name = "keywords";
+
+  std::vector<std::string> table;
+  while (w.keywords.size() < table_size) {
+    auto kw = gen.word(2, 14);
+    if (w.keywords.emplace(kw, int(w.keywords.size())).second) {
+      table.push_back(kw);
+    }
+  }
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i) {
+      w.data += ' ';
+    }
+    w.data += table[gen.between(0, std::uint32_t(table.size() - 1))];
+  }
+  w.tokens = count;
+  return w;
+}
+
+
+// Line-based "key value" statements, one token per statement.
+inline std::vector<std::string> const& statement_keys() {
+  static std::vector<std::string> const keys{
+      "alpha", "bind",  "cache", "depth", "echo", "fork",  "group", "host",
+      "index", "jobs",  "keep",  "limit", "mode", "nodes", "order", "port"};
+  return keys;
+}
+
+inline Workload make_statements(std::size_t count) {
+  Generator gen(8);
+  Workload w{"statements", "", 0};
+  auto const& keys = statement_keys();
+  for (std::size_t i = 0; i < count; ++i) {
+    w.data += keys[gen.between(0, std::uint32_t(keys.size() - 1))] + ' ' +
+              std::to_string(gen.between(0, 65535)) + '\n';
+    ++w.tokens;
+  }
+  return w;
+}
+
+}  // namespace bench
+
+#endif
@@ -0,0 +1,49 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_EXAMPLES_MATH_EXPRESSION_EXPR_PATTERN_H_
+#define ABULAFIA_EXAMPLES_MATH_EXPRESSION_EXPR_PATTERN_H_
+
+#include "abulafia/abulafia.h"
+
+// This simple example shows how to build an operator precedence parser using
+// abulafia.
+// This parser will evaluate the expression as its being parsed, storing the
+// result directly in the dst. Building an AST is a very similar process, which
+// you can see in (insert example reference here)
+inline auto make_expr_pattern(abu::RecurMemoryPool& pool) {
+  // Evaluates a single binary operation.
+  auto binop = [](char op, int lhs, int rhs) -> int {
+    switch (op) {
+      case '+':
+        return lhs + rhs;
+      case '-':
+        return lhs - rhs;
+      case '*':
+        return lhs * rhs;
+      case '/':
+        return lhs / rhs;
+    }
+    return 0;
+  };
+
+  abu::Recur<struct expr_t, int> expr(pool);
+  auto primary = abu::int_ | ('(' >> expr >> ')');
+
+  // Precedence levels, from loosest to tightest.
+  auto ops = abu::operators<char>(
+      primary,
+      {{abu::Assoc::LEFT, {{"+", '+'}, {"-", '-'}}},
+       {abu::Assoc::LEFT, {{"*", '*'}, {"/", '/'}}}},
+      binop);
+
+  ABU_Recur_define(expr, expr_t, ops);
+
+  return abu::apply_skipper(expr, abu::lit(' '));
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "abulafia/char_set/char_set.h"
 
 #include "abulafia/char_set/any.h"
+#include "abulafia/char_set/compiled.h"
 #include "abulafia/char_set/delegated.h"
 #include "abulafia/char_set/not.h"
 #include "abulafia/char_set/or.h"
@@ -23,17 +24,27 @@
 
 // Parsing Contexts
 
+#include "abulafia/data_source/container_ring.h"
 #include "abulafia/data_source/container_sequence.h"
+#include "abulafia/data_source/mapped_file.h"
 #include "abulafia/data_source/single_forward.h"
 
 // Operations
 #include "abulafia/operations/make_parser.h"
 #include "abulafia/operations/parse.h"
+#include "abulafia/operations/parse_file.h"
+#include "abulafia/operations/parse_records.h"
+#include "abulafia/operations/reusable_parser.h"
 
 // Patterns
 #include "abulafia/patterns/all.h"
 
 // Parsers
 #include "abulafia/parsers/coroutine/all.h"
+#include "abulafia/parsers/direct/all.h"
+
+// Lexing
+#include "abulafia/lexer/lexer.h"
+#include "abulafia/lexer/token.h"
 
 #endif
\ No newline at end of file
@@ -19,7 +19,7 @@ template <typename CHAR_T>
 struct Any : public CharacterSet {
   using char_t = CHAR_T;
 
-  bool is_valid(char_t const &) const { return true; }
+  constexpr bool is_valid(char_t const &) const { return true; }
 };
 
 template <typename CHAR_T>
@@ -25,11 +25,11 @@ struct to_char_set_impl;
 
 template <typename T>
 struct to_char_set_impl<T, std::enable_if_t<is_char_set<T>::value>> {
-  static T const& convert(T const& v) { return v; }
+  static constexpr T const& convert(T const& v) { return v; }
 };
 
 template <typename T>
-auto to_char_set(T v) {
+constexpr auto to_char_set(T v) {
   return to_char_set_impl<T>::convert(v);
 }
 
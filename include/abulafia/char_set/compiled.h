@@ -0,0 +1,109 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_CHAR_SET_COMPILED_H_
+#define ABULAFIA_CHAR_SET_COMPILED_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/char_set/any.h"
+#include "abulafia/char_set/char_set.h"
+#include "abulafia/char_set/set.h"
+#include "abulafia/char_set/single.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+namespace char_set {
+
+// A character set over an 8-bit character type, flattened into a lookup
+// table. Checking a character costs a single load, no matter how complex the
+// original set was.
+//
+// Sets made only of single(), range(), any, ~ and | can be compiled in a
+// constant expression. Compiling a delegated() set asks its callback about
+// every character once, and only uses these answers from then on.
+template <typename CHAR_T>
+struct Compiled : public CharacterSet {
+  using char_t = CHAR_T;
+
+  static_assert(sizeof(CHAR_T) == 1);
+
+  template <typename CHARSET_T>
+  constexpr explicit Compiled(CHARSET_T const& chars) {
+    for (std::size_t i = 0; i < table_.size(); ++i) {
+      table_[i] = chars.is_valid(char_t(i));
+      if (table_[i]) {
+        std::size_t lo = i & 0x0F;
+        std::size_t hi = i >> 4;
+        nibble_bitmaps_[lo + (hi & 8 ? 16 : 0)] |= std::uint8_t(1 << (hi & 7));
+      }
+    }
+  }
+
+  constexpr bool is_valid(char_t const& c) const {
+    return table_[as_index(c)];
+  }
+
+  // The same set, laid out for vectorized classification: entry L (resp.
+  // 16 + L) has bit H set if the character (H << 4 | L) (resp. ((H + 8) << 4
+  // | L)) belongs to the set.
+  constexpr std::array<std::uint8_t, 32> const& nibble_bitmaps() const {
+    return nibble_bitmaps_;
+  }
+
+ private:
+  using unsigned_t = std::make_unsigned_t<CHAR_T>;
+
+  static constexpr std::size_t as_index(CHAR_T c) { return unsigned_t(c); }
+
+  std::array<bool, 256> table_{};
+  std::array<std::uint8_t, 32> nibble_bitmaps_{};
+};
+
+// Wether compiling a character set would be worth it. Sets that are already a
+// single check are left alone.
+template <typename CHARSET_T>
+struct benefits_from_compilation
+    : public std::integral_constant<bool,
+                                    sizeof(typename CHARSET_T::char_t) == 1> {
+};
+
+template <typename CHAR_T>
+struct benefits_from_compilation<Any<CHAR_T>> : public std::false_type {};
+
+template <typename CHAR_T>
+struct benefits_from_compilation<Single<CHAR_T>> : public std::false_type {};
+
+template <typename CHAR_T>
+struct benefits_from_compilation<Set<CHAR_T>> : public std::false_type {};
+
+template <typename CHAR_T>
+struct benefits_from_compilation<IndexedSet<CHAR_T>> : public std::false_type {
+};
+
+template <typename CHAR_T>
+struct benefits_from_compilation<Compiled<CHAR_T>> : public std::false_type {};
+
+template <typename CHARSET_T>
+using compiled_t =
+    std::conditional_t<benefits_from_compilation<CHARSET_T>::value,
+                       Compiled<typename CHARSET_T::char_t>, CHARSET_T>;
+
+// Flattens a character set into a lookup table when possible, returns it
+// as-is otherwise.
+template <typename CHARSET_T>
+constexpr compiled_t<CHARSET_T> compile(CHARSET_T const& chars) {
+  return compiled_t<CHARSET_T>(chars);
+}
+
+}  // namespace char_set
+}  // namespace ABULAFIA_NAMESPACE
+#endif
@@ -18,7 +18,9 @@ namespace char_set {
 
 // Delegates the decision as to wether a character belongs to the set or not
 // to a callback.
-// Abulafia will assume that cb_ is deterministic.
+// Abulafia will assume that cb_ is deterministic. Over 8-bit characters,
+// char_() compiles the set as soon as the pattern is created: cb_ is called
+// once for every character then, and never again.
 template <typename CHAR_T, typename CB_T>
 struct DelegatedSet : public CharacterSet {
   using char_t = CHAR_T;
@@ -22,9 +22,11 @@ template <typename ARG_T>
 struct Not : public CharacterSet {
   using char_t = typename ARG_T::char_t;
 
-  explicit Not(ARG_T arg) : arg_(std::move(arg)) {}
+  constexpr explicit Not(ARG_T arg) : arg_(std::move(arg)) {}
 
-  bool is_valid(char_t const& c) const { return !arg_.is_valid(c); }
+  constexpr bool is_valid(char_t const& c) const {
+    return !arg_.is_valid(c);
+  }
 
  private:
   ARG_T arg_;
@@ -37,7 +39,7 @@ struct is_char_set<Not<ARG_T>> : public std::true_type {};
 
 template <typename ARG_T,
           typename Enable = std::enable_if_t<is_char_set<ARG_T>::value>>
-Not<ARG_T> operator~(ARG_T arg) {
+constexpr Not<ARG_T> operator~(ARG_T arg) {
   return Not<ARG_T>{std::move(arg)};
 }
 
@@ -20,9 +20,10 @@ template <typename LHS_T, typename RHS_T>
 struct Or : public CharacterSet {
   using char_t = typename LHS_T::char_t;
 
-  Or(LHS_T lhs, RHS_T rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
+  constexpr Or(LHS_T lhs, RHS_T rhs)
+      : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
 
-  bool is_valid(char_t const& c) const {
+  constexpr bool is_valid(char_t const& c) const {
     return lhs_.is_valid(c) || rhs_.is_valid(c);
   }
 
@@ -36,7 +37,7 @@ struct Or : public CharacterSet {
 };
 
 template <typename LHS_T, typename RHS_T>
-auto or_impl(LHS_T lhs, RHS_T rhs) {
+constexpr auto or_impl(LHS_T lhs, RHS_T rhs) {
   auto lhs_cs = to_char_set(std::decay_t<LHS_T>(lhs));
   auto rhs_cs = to_char_set(std::decay_t<RHS_T>(rhs));
 
@@ -46,7 +47,7 @@ auto or_impl(LHS_T lhs, RHS_T rhs) {
 template <typename LHS_T, typename RHS_T,
           typename = enable_if_t<is_char_set<LHS_T>::value ||
                                  is_char_set<RHS_T>::value>>
-auto operator|(LHS_T lhs, RHS_T rhs) {
+constexpr auto operator|(LHS_T lhs, RHS_T rhs) {
   return or_impl(lhs, rhs);
 }
 
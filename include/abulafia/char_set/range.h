@@ -20,9 +20,11 @@ template <typename CHAR_T>
 struct Range : public CharacterSet {
   using char_t = CHAR_T;
 
-  Range(CHAR_T b, CHAR_T e) : begin_(b), end_(e) { assert(b <= e); }
+  constexpr Range(CHAR_T b, CHAR_T e) : begin_(b), end_(e) {
+    assert(b <= e);
+  }
 
-  bool is_valid(char_t const& token) const {
+  constexpr bool is_valid(char_t const& token) const {
     return token >= begin_ && token <= end_;
   }
 
@@ -32,7 +34,7 @@ struct Range : public CharacterSet {
 };
 
 template <typename CHAR_T>
-inline auto range(CHAR_T b, CHAR_T e) {
+constexpr auto range(CHAR_T b, CHAR_T e) {
   return Range<CHAR_T>(b, e);
 }
 
@@ -28,7 +28,6 @@ struct Set : public CharacterSet {
   template <typename ITE_T>
   Set(ITE_T b, ITE_T e) : characters_(b, e) {}
 
-  template <typename T>
   bool is_valid(char_t const& character) const {
     return characters_.find(character) != characters_.end();
   }
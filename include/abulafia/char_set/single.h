@@ -19,10 +19,12 @@ template <typename CHAR_T>
 struct Single : public CharacterSet {
   using char_t = CHAR_T;
 
-  explicit Single(CHAR_T c) : character_(c) {}
+  constexpr explicit Single(CHAR_T c) : character_(c) {}
+
+  constexpr CHAR_T const& character() const { return character_; }
 
   template <typename T>
-  bool is_valid(T const& token) const {
+  constexpr bool is_valid(T const& token) const {
     return token == character_;
   }
 
@@ -31,13 +33,15 @@ struct Single : public CharacterSet {
 };
 
 template <typename CHAR_T>
-auto single(CHAR_T c) {
+constexpr auto single(CHAR_T c) {
   return Single<CHAR_T>(c);
 }
 
 template <>
 struct to_char_set_impl<char, void> {
-  static Single<char> convert(char const& v) { return Single<char>(v); }
+  static constexpr Single<char> convert(char const& v) {
+    return Single<char>(v);
+  }
 };
 
 }  // namespace char_set
@@ -13,6 +13,7 @@
 #include <type_traits>
 
 #include "abulafia/patterns/leaf/fail.h"
+#include "abulafia/support/arena.h"
 
 namespace ABULAFIA_NAMESPACE {
 template <typename DATASOURCE_T, typename SKIPPER_T, typename BOUND_DST_T = Nil>
@@ -21,8 +22,11 @@ struct Context {
   using skip_pattern_t = SKIPPER_T;
   using bound_dst_t = BOUND_DST_T;
 
-  Context(datasource_t& ds, skip_pattern_t const& skip, BOUND_DST_T bound_dst)
-      : data_(ds), skipper_(skip), bound_dst_(bound_dst) {}
+  // arena is where parsers allocate their state for the duration of the
+  // parse, they fall back to the heap if it is null.
+  Context(datasource_t& ds, skip_pattern_t const& skip, BOUND_DST_T bound_dst,
+          Arena* arena = nullptr)
+      : data_(ds), skipper_(skip), bound_dst_(bound_dst), arena_(arena) {}
 
   template <typename T>
   using set_skipper_t = Context<datasource_t, T, bound_dst_t>;
@@ -32,17 +36,20 @@ struct Context {
 
   enum {
     IS_RESUMABLE = DATASOURCE_T::IS_RESUMABLE,
+    IS_CONTIGUOUS = DATASOURCE_T::IS_CONTIGUOUS,
     HAS_SKIPPER = !std::is_same<Fail, skip_pattern_t>::value,
   };
 
   DATASOURCE_T& data() { return data_; }
   SKIPPER_T const& skipper() { return skipper_; }
   BOUND_DST_T const& bound_dst() { return bound_dst_; }
+  Arena* arena() { return arena_; }
 
  private:
   DATASOURCE_T& data_;
   SKIPPER_T const& skipper_;
   BOUND_DST_T bound_dst_;
+  Arena* arena_;
 };
 }  // namespace ABULAFIA_NAMESPACE
 
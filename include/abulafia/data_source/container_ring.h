@@ -0,0 +1,179 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_DATASOURCES_CONTAINER_RING_H_
+#define ABULAFIA_DATASOURCES_CONTAINER_RING_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/data_source/container_sequence.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Same behavior as ContainerSequenceDataSource, but buffers are moved into a
+// fixed array of SLOT_COUNT slots instead of being individually allocated.
+// Once the data source is done with a buffer, it is handed back through the
+// release callback, so that its storage can be reused for future reads.
+// Pros:
+//  - Resumable
+//  - Does not allocate anything per buffer
+// Cons:
+//  - At most SLOT_COUNT buffers can be held at any given time, callers
+//    must check full() before adding a buffer.
+//  - If only 1 byte of a buffer is needed for rollback, the entire buffer
+//    will be kept.
+template <typename CONTAINER_T, std::size_t SLOT_COUNT = 8>
+class ContainerRingDataSource {
+  static_assert(SLOT_COUNT > 0);
+
+  using iterator = typename CONTAINER_T::const_iterator;
+
+  // Buffers are identified by a monotonically increasing sequence number,
+  // which maps to slot (seq % SLOT_COUNT).
+  using seq_t = std::size_t;
+
+  std::array<CONTAINER_T, SLOT_COUNT> slots_;
+  seq_t head_ = 0;  // Oldest buffer still held.
+  seq_t tail_ = 0;  // One past the newest buffer.
+  bool final_ = false;
+
+  iterator current_;
+  seq_t current_buffer_ = 0;
+
+  using rollback_entry_t = std::pair<iterator, seq_t>;
+  std::vector<rollback_entry_t> rollback_stack_;
+  int empty_rollbacks_ = 0;
+
+ public:
+  using value_type = typename CONTAINER_T::value_type;
+  using release_callback_t = std::function<void(CONTAINER_T&&)>;
+
+  enum { IS_RESUMABLE = true, IS_CONTIGUOUS = false };
+
+  ContainerRingDataSource() = default;
+  explicit ContainerRingDataSource(release_callback_t release_buffer)
+      : release_buffer_(std::move(release_buffer)) {}
+
+  ContainerRingDataSource(ContainerRingDataSource const&) = delete;
+
+  // The callback receives every buffer that the data source no longer needs.
+  void set_release_callback(release_callback_t release_buffer) {
+    release_buffer_ = std::move(release_buffer);
+  }
+
+  bool full() const { return tail_ - head_ == SLOT_COUNT; }
+
+  void add_buffer(CONTAINER_T b, IsFinal f = IsFinal::NOT_FINAL) {
+    assert(!final_);
+
+    if (b.begin() != b.end()) {
+      assert(!full());
+      bool is_empty = empty();
+
+      auto& slot = slots_[tail_ % SLOT_COUNT];
+      slot = std::move(b);
+      ++tail_;
+
+      // if we were empty, bootstrap.
+      if (is_empty) {
+        current_ = slot.begin();
+        for (int i = 0; i < empty_rollbacks_; ++i) {
+          rollback_stack_.emplace_back(current_, current_buffer_);
+        }
+        empty_rollbacks_ = 0;
+      }
+    } else {
+      release_(std::move(b));
+    }
+    final_ = f == IsFinal::FINAL;
+  }
+
+  bool final_buffer() const { return final_; }
+
+  value_type next() const {
+    assert(!empty());
+    return *current_;
+  }
+
+  void advance() {
+    current_++;
+    if (current_ == slot_(current_buffer_).end()) {
+      ++current_buffer_;
+      if (current_buffer_ != tail_) {
+        current_ = slot_(current_buffer_).begin();
+      } else {
+        current_ = iterator();
+      }
+      cleanup_();
+    }
+  }
+
+  bool empty() const { return current_buffer_ == tail_; }
+
+  void prepare_rollback() {
+    if (empty()) {
+      ++empty_rollbacks_;
+    } else {
+      rollback_stack_.emplace_back(current_, current_buffer_);
+    }
+  }
+
+  void commit_rollback() {
+    if (empty_rollbacks_) {
+      --empty_rollbacks_;
+    } else {
+      current_buffer_ = rollback_stack_.back().second;
+      current_ = rollback_stack_.back().first;
+      rollback_stack_.pop_back();
+      cleanup_();
+    }
+  }
+
+  void cancel_rollback() {
+    if (empty_rollbacks_) {
+      --empty_rollbacks_;
+    } else {
+      rollback_stack_.pop_back();
+      cleanup_();
+    }
+  }
+
+ private:
+  CONTAINER_T const& slot_(seq_t seq) const { return slots_[seq % SLOT_COUNT]; }
+
+  void release_(CONTAINER_T&& b) {
+    if (release_buffer_) {
+      release_buffer_(std::move(b));
+    }
+  }
+
+  // Hands back every buffer that precedes both the read position and the
+  // oldest rollback point.
+  void cleanup_() {
+    seq_t hold = rollback_stack_.empty() ? current_buffer_
+                                         : rollback_stack_.front().second;
+    while (head_ < hold) {
+      auto& slot = slots_[head_ % SLOT_COUNT];
+      release_(std::move(slot));
+      slot = CONTAINER_T();
+      ++head_;
+    }
+  }
+
+  release_callback_t release_buffer_;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
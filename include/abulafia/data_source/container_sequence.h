@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include <cassert>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <vector>
@@ -24,11 +25,24 @@ namespace ABULAFIA_NAMESPACE {
 //  - Does not perform any large allocation/moves
 // Cons:
 //  - If only 1 byte of a buffer is needed for rollback, the entire buffer
-//    will be kept.
+//    will be kept. (unless RollbackPinning::PRECISE is used)
 
 enum class IsFinal { FINAL, NOT_FINAL };
 
-template <typename CONTAINER_T>
+// How buffers that are partially needed for rollback are held.
+enum class RollbackPinning {
+  // The entire buffer is kept.
+  WHOLE_BUFFER,
+
+  // Once the read position has moved past a buffer, the part of it that is
+  // still needed for rollback is copied into a smaller carry-over buffer, and
+  // the original is released. This requires CONTAINER_T to be constructible
+  // from a pair of iterators.
+  PRECISE,
+};
+
+template <typename CONTAINER_T,
+          RollbackPinning PINNING = RollbackPinning::WHOLE_BUFFER>
 class ContainerSequenceDataSource {
   using iterator = typename CONTAINER_T::const_iterator;
   using buffer_list_t = std::list<std::shared_ptr<CONTAINER_T>>;
@@ -47,7 +61,7 @@ class ContainerSequenceDataSource {
  public:
   using value_type = typename CONTAINER_T::value_type;
 
-  enum { IS_RESUMABLE = true };
+  enum { IS_RESUMABLE = true, IS_CONTIGUOUS = false };
 
   ContainerSequenceDataSource() : current_buffer_(buffers_.end()) {}
 
@@ -99,18 +113,11 @@ class ContainerSequenceDataSource {
         current_ = iterator();
       }
 
-      // iI we are done with the front buffer, and the rollback stack
-      // has no hold on it, dump the buffer.
-      if (current_buffer_ == buffers_.begin()) {
-        bool held_for_rollback =
-            !rollback_stack_.empty() &&
-            rollback_stack_.front().second == current_buffer_;
-        if (!held_for_rollback) {
-          buffers_.pop_front();
-        }
-      }
-
       current_buffer_ = next_buffer;
+
+      // We are done with the previous buffer, dump it unless the rollback
+      // stack has a hold on it.
+      release_unpinned_();
     }
   }
 
@@ -131,7 +138,7 @@ class ContainerSequenceDataSource {
       current_buffer_ = rollback_stack_.back().second;
       current_ = rollback_stack_.back().first;
       rollback_stack_.pop_back();
-      cleanup_rollback_();
+      release_unpinned_();
     }
   }
 
@@ -140,19 +147,52 @@ class ContainerSequenceDataSource {
       --empty_rollbacks_;
     } else {
       rollback_stack_.pop_back();
-      cleanup_rollback_();
+      release_unpinned_();
     }
   }
 
  private:
-  void cleanup_rollback_() {
-    // The only hold that matters is the front of the rollback stack.
-    // This means cleanup will only happen when the entire stack has unrolled.
-    if (rollback_stack_.empty()) {
-      while (current_buffer_ != buffers_.begin()) {
-        buffers_.pop_front();
+  void release_unpinned_() {
+    // The only hold that matters is the front of the rollback stack, since
+    // rollback points are ordered by position.
+    buffer_iterator hold = rollback_stack_.empty()
+                               ? current_buffer_
+                               : rollback_stack_.front().second;
+    while (hold != buffers_.begin()) {
+      buffers_.pop_front();
+    }
+
+    if constexpr (PINNING == RollbackPinning::PRECISE) {
+      if (hold != current_buffer_) {
+        compact_pinned_();
+      }
+    }
+  }
+
+  // Replaces the front buffer with a copy of the part of it that is still
+  // reachable by the rollback stack.
+  void compact_pinned_() {
+    auto& pinned = *buffers_.begin();
+    iterator pin = rollback_stack_.front().first;
+
+    auto pinned_size = std::distance(pin, iterator(pinned->end()));
+    auto total_size =
+        std::distance(iterator(pinned->begin()), iterator(pinned->end()));
+
+    // Not worth a copy.
+    if (pinned_size * 2 > total_size) {
+      return;
+    }
+
+    auto carry = std::make_shared<CONTAINER_T>(pin, iterator(pinned->end()));
+    for (auto& entry : rollback_stack_) {
+      if (entry.second != buffers_.begin()) {
+        break;
       }
+      auto offset = std::distance(pin, entry.first);
+      entry.first = std::next(iterator(carry->begin()), offset);
     }
+    pinned = std::move(carry);
   }
 };
 
@@ -0,0 +1,46 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_DATASOURCES_MAPPED_FILE_H_
+#define ABULAFIA_DATASOURCES_MAPPED_FILE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/data_source/single_forward.h"
+#include "abulafia/support/mapped_file.h"
+
+#include <cstddef>
+#include <string>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Maps a file in memory, and parses straight out of the mapping.
+// Pros:
+//  - No copy of the file is ever made.
+//  - Pages are only brought in as the parser reaches them.
+//  - Contiguous, so leaf parsers get to use their bulk fast paths.
+// Cons:
+//  - Not resumable, the whole file is available from the start.
+template <std::size_t ROLLBACK_CAPACITY = 16>
+class MappedFileDataSource
+    : private MappedFile,
+      public SingleForwardDataSource<char const*, ROLLBACK_CAPACITY> {
+  using data_source_t = SingleForwardDataSource<char const*, ROLLBACK_CAPACITY>;
+
+ public:
+  explicit MappedFileDataSource(std::string const& path)
+      : MappedFile(path),
+        data_source_t(MappedFile::begin(), MappedFile::end()) {}
+
+  using data_source_t::size;
+
+  std::size_t file_size() const { return MappedFile::size(); }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
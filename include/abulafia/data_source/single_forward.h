@@ -10,18 +10,34 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/support/small_stack.h"
+#include "abulafia/support/type_traits.h"
+
+#include <atomic>
 #include <cassert>
-#include <stack>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
 
 namespace ABULAFIA_NAMESPACE {
 
+namespace single_forward_ {
+inline std::atomic<std::uint64_t> last_generation{0};
+}  // namespace single_forward_
+
 // It is fed a single set of data at construction, and will never
 // receive anything else. It maintains a light rollback stack that
 // has no cost associated with in in next/advance/empty.
-template <typename ITE_T>
+//
+// The first ROLLBACK_CAPACITY rollback points are stored inline, so that
+// only deeply recursive grammars cause allocations.
+template <typename ITE_T, std::size_t ROLLBACK_CAPACITY = 16,
+          typename Enable = void>
 class SingleForwardDataSource {
   using iterator = ITE_T;
-  std::stack<iterator> rollback_stack_;
+  SmallStack<iterator, ROLLBACK_CAPACITY> rollback_stack_;
 
   iterator current_;
   iterator end_;
@@ -33,7 +49,7 @@ class SingleForwardDataSource {
 
   using value_type = decltype(*(ITE_T()));
 
-  enum { IS_RESUMABLE = false };
+  enum { IS_RESUMABLE = false, IS_CONTIGUOUS = false };
 
   SingleForwardDataSource(iterator b, iterator e) : current_(b), end_(e) {}
   SingleForwardDataSource(SingleForwardDataSource const&) = delete;
@@ -60,6 +76,91 @@ class SingleForwardDataSource {
   }
 
   bool empty() const { return current_ == end_; }
+
+  // Number of tokens that have not been consumed yet.
+  std::size_t size() const {
+    return std::size_t(std::distance(current_, end_));
+  }
+};
+
+// When the data lives in contiguous memory, the remaining input is exposed
+// as a string_view, which lets leaf parsers match whole runs of tokens with a
+// single bounds check.
+template <typename ITE_T, std::size_t ROLLBACK_CAPACITY>
+class SingleForwardDataSource<
+    ITE_T, ROLLBACK_CAPACITY,
+    enable_if_t<is_contiguous_iterator<ITE_T>::value>> {
+ public:
+  using value_type = decay_t<decltype(*(ITE_T()))>;
+  using view_type = std::basic_string_view<value_type>;
+
+ private:
+  using iterator = value_type const*;
+  SmallStack<iterator, ROLLBACK_CAPACITY> rollback_stack_;
+
+  iterator current_;
+  iterator end_;
+  std::uint64_t generation_ = 0;
+
+ public:
+  enum {
+    HAS_SKIPPER = false,
+  };
+
+  enum { IS_RESUMABLE = false, IS_CONTIGUOUS = true };
+
+  SingleForwardDataSource(ITE_T b, ITE_T e)
+      : current_(b == e ? nullptr : std::addressof(*b)),
+        end_(current_ + std::distance(b, e)) {}
+  SingleForwardDataSource(SingleForwardDataSource const&) = delete;
+  constexpr bool final_buffer() const { return true; }
+
+  void prepare_rollback() { rollback_stack_.push(current_); }
+
+  void commit_rollback() {
+    assert(!rollback_stack_.empty());
+    current_ = rollback_stack_.top();
+    rollback_stack_.pop();
+  }
+
+  void cancel_rollback() {
+    assert(!rollback_stack_.empty());
+    rollback_stack_.pop();
+  }
+
+  value_type next() const { return *current_; }
+
+  void advance() {
+    assert(!empty());
+    current_++;
+  }
+
+  // Consumes n tokens at once.
+  void advance(std::size_t n) {
+    assert(n <= std::size_t(end_ - current_));
+    current_ += n;
+  }
+
+  bool empty() const { return current_ == end_; }
+
+  std::size_t size() const { return std::size_t(end_ - current_); }
+
+  // Tells this parse apart from every other one, including later parses of
+  // data that lives at the same address. Only assigned on first use.
+  std::uint64_t generation() {
+    if (generation_ == 0) {
+      generation_ =
+          single_forward_::last_generation.fetch_add(
+              1, std::memory_order_relaxed) +
+          1;
+    }
+    return generation_;
+  }
+
+  // Everything that has not been consumed yet.
+  view_type remaining() const {
+    return view_type(current_, std::size_t(end_ - current_));
+  }
 };
 
 }  // namespace ABULAFIA_NAMESPACE
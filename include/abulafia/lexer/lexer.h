@@ -0,0 +1,460 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_LEXER_LEXER_H_
+#define ABULAFIA_LEXER_LEXER_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/lexer/token.h"
+#include "abulafia/patterns/leaf/character.h"
+#include "abulafia/patterns/leaf/pass.h"
+#include "abulafia/patterns/leaf/string_literal.h"
+#include "abulafia/patterns/nary/alternative.h"
+#include "abulafia/patterns/nary/sequence.h"
+#include "abulafia/patterns/pattern.h"
+#include "abulafia/patterns/unary/discard.h"
+#include "abulafia/patterns/unary/optional.h"
+#include "abulafia/patterns/unary/repeat.h"
+#include "abulafia/result.h"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+namespace lex_ {
+using CharBits = std::bitset<256>;
+
+constexpr std::size_t no_match = std::size_t(-1);
+
+// Thompson-style automaton, built straight from the patterns.
+struct Nfa {
+  struct State {
+    std::vector<std::pair<CharBits, std::size_t>> edges;
+    std::vector<std::size_t> eps;
+    std::size_t accepts = no_match;
+  };
+
+  std::vector<State> states;
+
+  std::size_t add_state() {
+    states.emplace_back();
+    return states.size() - 1;
+  }
+
+  void add_eps(std::size_t from, std::size_t to) {
+    states[from].eps.push_back(to);
+  }
+
+  void add_edge(std::size_t from, CharBits const& chars, std::size_t to) {
+    states[from].edges.emplace_back(chars, to);
+  }
+};
+
+// Adds the states matching pat to nfa, starting at from. build() returns the
+// state that is reached once pat has matched.
+template <typename PAT_T, typename ENABLE = void>
+struct NfaBuilder {
+  static_assert(sizeof(PAT_T) == 0,
+                "This pattern can't be used to define a token.");
+};
+
+template <typename PAT_T>
+std::size_t build(Nfa& nfa, std::size_t from, PAT_T const& pat) {
+  return NfaBuilder<PAT_T>::build(nfa, from, pat);
+}
+
+template <typename CHARSET_T>
+struct NfaBuilder<Char<CHARSET_T>> {
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           Char<CHARSET_T> const& pat) {
+    using char_t = typename Char<CHARSET_T>::char_set_t::char_t;
+    static_assert(sizeof(char_t) == 1, "Lexers only work on bytes.");
+
+    CharBits chars;
+    for (std::size_t i = 0; i < 256; ++i) {
+      chars[i] = pat.char_set().is_valid(char_t(i));
+    }
+
+    auto to = nfa.add_state();
+    nfa.add_edge(from, chars, to);
+    return to;
+  }
+};
+
+template <typename CHAR_T>
+struct NfaBuilder<StringLiteral<CHAR_T>> {
+  static_assert(sizeof(CHAR_T) == 1, "Lexers only work on bytes.");
+
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           StringLiteral<CHAR_T> const& pat) {
+    for (auto c : pat) {
+      CharBits chars;
+      chars[static_cast<unsigned char>(c)] = true;
+
+      auto to = nfa.add_state();
+      nfa.add_edge(from, chars, to);
+      from = to;
+    }
+    return from;
+  }
+};
+
+template <>
+struct NfaBuilder<Pass> {
+  static std::size_t build(Nfa&, std::size_t from, Pass const&) {
+    return from;
+  }
+};
+
+template <typename PAT_T>
+struct NfaBuilder<Discard<PAT_T>> {
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           Discard<PAT_T> const& pat) {
+    return lex_::build(nfa, from, pat.operand());
+  }
+};
+
+template <typename PAT_T>
+struct NfaBuilder<Optional<PAT_T>> {
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           Optional<PAT_T> const& pat) {
+    auto to = lex_::build(nfa, from, pat.operand());
+    nfa.add_eps(from, to);
+    return to;
+  }
+};
+
+template <typename PAT_T, int MIN_REP, int MAX_REP>
+struct NfaBuilder<Repeat<PAT_T, MIN_REP, MAX_REP>> {
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           Repeat<PAT_T, MIN_REP, MAX_REP> const& pat) {
+    for (int i = 0; i < MIN_REP; ++i) {
+      from = lex_::build(nfa, from, pat.operand());
+    }
+
+    if constexpr (MAX_REP == 0) {
+      auto loop = nfa.add_state();
+      nfa.add_eps(from, loop);
+      nfa.add_eps(lex_::build(nfa, loop, pat.operand()), loop);
+      return loop;
+    } else {
+      auto to = nfa.add_state();
+      nfa.add_eps(from, to);
+      for (int i = MIN_REP; i < MAX_REP; ++i) {
+        from = lex_::build(nfa, from, pat.operand());
+        nfa.add_eps(from, to);
+      }
+      return to;
+    }
+  }
+};
+
+template <typename... CHILD_PATS_T>
+struct NfaBuilder<Seq<CHILD_PATS_T...>> {
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           Seq<CHILD_PATS_T...> const& pat) {
+    std::apply(
+        [&](auto const&... childs) {
+          ((from = lex_::build(nfa, from, childs)), ...);
+        },
+        pat.childs());
+    return from;
+  }
+};
+
+template <typename... CHILD_PATS_T>
+struct NfaBuilder<Alt<CHILD_PATS_T...>> {
+  static std::size_t build(Nfa& nfa, std::size_t from,
+                           Alt<CHILD_PATS_T...> const& pat) {
+    auto to = nfa.add_state();
+    std::apply(
+        [&](auto const&... childs) {
+          (nfa.add_eps(lex_::build(nfa, from, childs), to), ...);
+        },
+        pat.childs());
+    return to;
+  }
+};
+
+// The NFA states reachable from states without consuming anything.
+inline std::vector<std::size_t> closure(Nfa const& nfa,
+                                        std::vector<std::size_t> states) {
+  std::vector<bool> seen(nfa.states.size());
+  for (auto s : states) {
+    seen[s] = true;
+  }
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    for (auto next : nfa.states[states[i]].eps) {
+      if (!seen[next]) {
+        seen[next] = true;
+        states.push_back(next);
+      }
+    }
+  }
+
+  std::vector<std::size_t> result;
+  for (std::size_t i = 0; i < seen.size(); ++i) {
+    if (seen[i]) {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+}  // namespace lex_
+
+template <typename CHAR_T>
+class LexerBuilder;
+
+// Cuts data into tokens, always going for the longest possible token. When
+// several definitions match the same text, the first one wins.
+//
+// All definitions are compiled into a single DFA. Characters that no
+// definition tells apart share a column of its transition table.
+template <typename CHAR_T = char>
+class Lexer {
+ public:
+  using token_t = Token<CHAR_T>;
+  using view_t = std::basic_string_view<CHAR_T>;
+
+  // Appends the tokens of data to dst. Stops at the first character that
+  // does not start a token, and returns FAILURE if there is one.
+  //
+  // Runs in linear time: scanning past the end of a token is what makes
+  // longest match expensive, so every state the scanner reaches after the
+  // last match is remembered as a dead end for its position, and later scans
+  // stop as soon as they run into one.
+  Result tokenize(view_t data, std::vector<token_t>& dst) const {
+    return tokenize_(data, dst, nullptr);
+  }
+
+  // Same as above, and adds the number of DFA transitions taken to
+  // transitions. That count stays within a small multiple of data.size().
+  Result tokenize(view_t data, std::vector<token_t>& dst,
+                  std::size_t& transitions) const {
+    return tokenize_(data, dst, &transitions);
+  }
+
+  std::size_t state_count() const { return accepts_.size(); }
+  std::size_t class_count() const { return class_count_; }
+
+ private:
+  friend class LexerBuilder<CHAR_T>;
+
+  static constexpr std::uint32_t dead_state = 0;
+  static constexpr std::uint32_t start_state = 1;
+
+  Result tokenize_(view_t data, std::vector<token_t>& dst,
+                   std::size_t* transitions) const {
+    std::size_t steps = 0;
+
+    // Keyed by position * state_count() + state.
+    std::unordered_set<std::size_t> dead_ends;
+    std::size_t dead_ends_end = 0;
+
+    std::size_t pos = 0;
+    while (pos < data.size()) {
+      if (pos + 1 >= dead_ends_end && !dead_ends.empty()) {
+        dead_ends.clear();
+      }
+
+      std::uint32_t state = start_state;
+      std::uint32_t match_state = start_state;
+      std::size_t match = lex_::no_match;
+      std::size_t match_end = pos;
+
+      std::size_t i = pos;
+      for (; i < data.size(); ++i) {
+        ++steps;
+        auto next = table_[state * class_count_ + class_of_(data[i])];
+        if (next == dead_state ||
+            (i + 1 < dead_ends_end &&
+             dead_ends.count(dead_end_key_(next, i + 1)) != 0)) {
+          break;
+        }
+        state = next;
+        if (accepts_[state] != lex_::no_match) {
+          match = accepts_[state];
+          match_end = i + 1;
+          match_state = state;
+        }
+      }
+
+      if (match == lex_::no_match) {
+        if (transitions) {
+          *transitions += steps;
+        }
+        return Result::FAILURE;
+      }
+
+      // Nothing between match_end and i led anywhere.
+      if (i > match_end) {
+        state = match_state;
+        for (std::size_t j = match_end; j < i; ++j) {
+          ++steps;
+          state = table_[state * class_count_ + class_of_(data[j])];
+          dead_ends.insert(dead_end_key_(state, j + 1));
+        }
+        dead_ends_end = std::max(dead_ends_end, i + 1);
+      }
+
+      if (definitions_[match].emit) {
+        dst.push_back({definitions_[match].kind,
+                       data.substr(pos, match_end - pos)});
+      }
+      pos = match_end;
+    }
+    if (transitions) {
+      *transitions += steps;
+    }
+    return Result::SUCCESS;
+  }
+
+  std::uint8_t class_of_(CHAR_T c) const {
+    return classes_[static_cast<unsigned char>(c)];
+  }
+
+  std::size_t dead_end_key_(std::uint32_t state, std::size_t pos) const {
+    return pos * accepts_.size() + state;
+  }
+
+  struct Definition {
+    std::size_t kind;
+    bool emit;
+  };
+
+  std::vector<Definition> definitions_;
+  std::array<std::uint8_t, 256> classes_{};
+  std::size_t class_count_ = 0;
+  std::vector<std::uint32_t> table_;
+  std::vector<std::size_t> accepts_;
+};
+
+// Collects token definitions. Any pattern made of characters, literals,
+// sequences, alternatives, optionals and repetitions can define a token.
+template <typename CHAR_T = char>
+class LexerBuilder {
+  static_assert(sizeof(CHAR_T) == 1, "Lexers only work on bytes.");
+
+ public:
+  LexerBuilder() { nfa_.add_state(); }
+
+  // Tokens matching pat will be emitted with the given kind.
+  template <typename KIND_T, typename PAT_T>
+  LexerBuilder& add(KIND_T kind, PAT_T const& pat) {
+    add_(std::size_t(kind), true, make_pattern(pat));
+    return *this;
+  }
+
+  // Text matching pat, such as whitespace, will be dropped.
+  template <typename PAT_T>
+  LexerBuilder& skip(PAT_T const& pat) {
+    add_(0, false, make_pattern(pat));
+    return *this;
+  }
+
+  Lexer<CHAR_T> build() const {
+    using lexer_t = Lexer<CHAR_T>;
+    lexer_t result;
+    result.definitions_ = definitions_;
+
+    // Characters that every edge of the NFA treats the same way are
+    // interchangeable.
+    std::vector<lex_::CharBits const*> edge_chars;
+    for (auto const& state : nfa_.states) {
+      for (auto const& edge : state.edges) {
+        edge_chars.push_back(&edge.first);
+      }
+    }
+
+    std::map<std::vector<bool>, std::uint8_t> class_ids;
+    std::vector<std::size_t> class_reps;
+    for (std::size_t c = 0; c < 256; ++c) {
+      std::vector<bool> key;
+      for (auto chars : edge_chars) {
+        key.push_back((*chars)[c]);
+      }
+      auto found = class_ids.find(key);
+      if (found == class_ids.end()) {
+        found = class_ids.emplace(key, std::uint8_t(class_reps.size())).first;
+        class_reps.push_back(c);
+      }
+      result.classes_[c] = found->second;
+    }
+    result.class_count_ = class_reps.size();
+
+    // Subset construction.
+    std::map<std::vector<std::size_t>, std::uint32_t> ids;
+    std::vector<std::vector<std::size_t>> sets;
+    auto get_id = [&](std::vector<std::size_t> set) {
+      auto found = ids.find(set);
+      if (found != ids.end()) {
+        return found->second;
+      }
+      auto id = std::uint32_t(sets.size());
+      ids.emplace(set, id);
+      sets.push_back(std::move(set));
+      return id;
+    };
+
+    get_id({});
+    get_id(lex_::closure(nfa_, {0}));
+
+    for (std::size_t id = 0; id < sets.size(); ++id) {
+      std::size_t accepts = lex_::no_match;
+      for (auto s : sets[id]) {
+        accepts = std::min(accepts, nfa_.states[s].accepts);
+      }
+      result.accepts_.push_back(accepts);
+
+      for (auto rep : class_reps) {
+        std::vector<std::size_t> next;
+        for (auto s : sets[id]) {
+          for (auto const& edge : nfa_.states[s].edges) {
+            if (edge.first[rep]) {
+              next.push_back(edge.second);
+            }
+          }
+        }
+        auto next_id = next.empty() ? lexer_t::dead_state
+                                    : get_id(lex_::closure(nfa_, next));
+        result.table_.push_back(next_id);
+      }
+    }
+    return result;
+  }
+
+ private:
+  template <typename PAT_T>
+  void add_(std::size_t kind, bool emit, PAT_T const& pat) {
+    auto from = nfa_.add_state();
+    nfa_.add_eps(0, from);
+
+    auto to = lex_::build(nfa_, from, pat);
+    auto& accepts = nfa_.states[to].accepts;
+    accepts = std::min(accepts, definitions_.size());
+
+    definitions_.push_back({kind, emit});
+  }
+
+  lex_::Nfa nfa_;
+  std::vector<typename Lexer<CHAR_T>::Definition> definitions_;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
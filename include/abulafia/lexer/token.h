@@ -0,0 +1,38 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_LEXER_TOKEN_H_
+#define ABULAFIA_LEXER_TOKEN_H_
+
+#include "abulafia/config.h"
+
+#include <cstddef>
+#include <string_view>
+
+namespace ABULAFIA_NAMESPACE {
+
+// What a Lexer cuts the data into. The text points into the data that was
+// tokenized, so it must outlive the token.
+template <typename CHAR_T = char>
+struct Token {
+  std::size_t kind;
+  std::basic_string_view<CHAR_T> text;
+};
+
+template <typename CHAR_T>
+bool operator==(Token<CHAR_T> const& lhs, Token<CHAR_T> const& rhs) {
+  return lhs.kind == rhs.kind && lhs.text == rhs.text;
+}
+
+template <typename CHAR_T>
+bool operator!=(Token<CHAR_T> const& lhs, Token<CHAR_T> const& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -15,14 +15,17 @@
 #include "abulafia/parsers/coroutine/parser_factory.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/result.h"
+#include "abulafia/support/arena.h"
 #include "abulafia/support/nil.h"
 
+#include <type_traits>
+
 namespace ABULAFIA_NAMESPACE {
 
 template <typename REAL_PAT_T, typename REAL_DST_T, typename DATASOURCE_T>
 struct ParserInterface {
   ParserInterface(REAL_PAT_T const& pat, REAL_DST_T& dst)
-      : ctx_(data_source_, fail, dst),
+      : ctx_(data_source_, fail, dst, &arena_),
         pat_(pat),
         dst_(dst),
         parser_(ctx_, dst, pat) {}
@@ -33,6 +36,7 @@ struct ParserInterface {
  private:
   using CTX_T = Context<DATASOURCE_T, Fail, REAL_DST_T>;
 
+  Arena arena_;
   DATASOURCE_T data_source_;
   CTX_T ctx_;
   REAL_PAT_T pat_;
@@ -40,14 +44,26 @@ struct ParserInterface {
   Parser<CTX_T, REAL_DST_T, DefaultReqs, REAL_PAT_T> parser_;
 };
 
+// make_parser<T>() accepts either a buffer type, which will be fed through a
+// ContainerSequenceDataSource, or a data source type to be used as is.
+template <typename T, typename Enable = void>
+struct SelectDataSource {
+  using type = ContainerSequenceDataSource<T>;
+};
+
+template <typename T>
+struct SelectDataSource<T, std::void_t<decltype(T::IS_RESUMABLE)>> {
+  using type = T;
+};
+
 template <typename BUFFER_T, typename PAT_T, typename DST_T>
 auto make_parser(PAT_T const& p, DST_T& s) {
   auto real_pat = make_pattern(p);
   auto real_dst = wrap_dst(s);
 
   return ParserInterface<decltype(real_pat), decltype(real_dst),
-                         ContainerSequenceDataSource<BUFFER_T>>(real_pat,
-                                                                real_dst);
+                         typename SelectDataSource<BUFFER_T>::type>(real_pat,
+                                                                    real_dst);
 }
 
 template <typename BUFFER_T, typename PAT_T>
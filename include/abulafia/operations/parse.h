@@ -14,6 +14,7 @@
 #include "abulafia/dst_wrapper/select_wrapper.h"
 
 #include "abulafia/parsers/coroutine/parser_factory.h"
+#include "abulafia/parsers/direct/direct_parser.h"
 #include "abulafia/patterns/leaf/fail.h"
 
 #include "abulafia/context.h"
@@ -28,16 +29,24 @@ namespace ABULAFIA_NAMESPACE {
 // If you need a multi-buffer parser, use make_parser() instead.
 template <typename ITE_T, typename PAT_T, typename DST_T>
 Result parse(ITE_T b, ITE_T e, const PAT_T& pat, DST_T& dst) {
-  SingleForwardDataSource<ITE_T> data(b, e);
-
   auto real_pat = make_pattern(pat);
   auto real_dst = wrap_dst(dst);
-  Context<SingleForwardDataSource<ITE_T>, Fail, decltype(real_dst)> real_ctx(
-      data, fail, real_dst);
-
-  auto parser = make_parser_(real_ctx, real_dst, DefaultReqs(), real_pat);
 
-  return parser.consume(real_ctx, real_dst, real_pat);
+  // Every level of the pattern tree can hold at most a rollback point for
+  // itself and one for its clean-failure adapter.
+  constexpr std::size_t rollback_capacity =
+      2 * pattern_depth<decltype(real_pat)>::value;
+  using data_source_t = SingleForwardDataSource<ITE_T, rollback_capacity>;
+
+  // Recursive parsers keep their state there, and it all goes away at once.
+  Arena arena;
+  data_source_t data(b, e);
+  Context<data_source_t, Fail, decltype(real_dst)> real_ctx(data, fail,
+                                                            real_dst, &arena);
+
+  // All the data is available upfront, so the pattern is parsed by plain
+  // recursive descent instead of a tree of coroutine parsers.
+  return parse_direct<DefaultReqs>(real_ctx, real_dst, real_pat);
 }
 
 // calling parse() with no dst implies using a Nil as destination.
@@ -0,0 +1,54 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_OPERATIONS_PARSE_FILE_H_
+#define ABULAFIA_OPERATIONS_PARSE_FILE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/data_source/mapped_file.h"
+#include "abulafia/dst_wrapper/select_wrapper.h"
+
+#include "abulafia/parsers/coroutine/parser_factory.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/leaf/fail.h"
+
+#include "abulafia/context.h"
+#include "abulafia/patterns/pattern.h"
+#include "abulafia/result.h"
+
+#include <string>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Same as parse(), but reads the data straight from a memory-mapped file.
+// Throws std::system_error if the file cannot be mapped.
+template <typename PAT_T, typename DST_T>
+Result parse_file(std::string const& path, const PAT_T& pat, DST_T& dst) {
+  auto real_pat = make_pattern(pat);
+  auto real_dst = wrap_dst(dst);
+
+  constexpr std::size_t rollback_capacity =
+      2 * pattern_depth<decltype(real_pat)>::value;
+  using data_source_t = MappedFileDataSource<rollback_capacity>;
+
+  Arena arena;
+  data_source_t data(path);
+  Context<data_source_t, Fail, decltype(real_dst)> real_ctx(data, fail,
+                                                            real_dst, &arena);
+
+  return parse_direct<DefaultReqs>(real_ctx, real_dst, real_pat);
+}
+
+template <typename PAT_T>
+Result parse_file(std::string const& path, const PAT_T& pat) {
+  return parse_file(path, pat, nil);
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,420 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_OPERATIONS_PARSE_RECORDS_H_
+#define ABULAFIA_OPERATIONS_PARSE_RECORDS_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/data_source/single_forward.h"
+#include "abulafia/dst_wrapper/select_wrapper.h"
+
+#include "abulafia/parsers/coroutine/parser_factory.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/leaf/fail.h"
+
+#include "abulafia/context.h"
+#include "abulafia/patterns/pattern.h"
+#include "abulafia/result.h"
+#include "abulafia/support/arena.h"
+#include "abulafia/support/nil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+namespace records_ {
+// What parse_records() expects of its arguments.
+template <typename ITE_T, typename PAT_T, typename SEP_T, typename DST_T>
+constexpr void check_args() {
+  static_assert(
+      std::is_base_of<
+          std::random_access_iterator_tag,
+          typename std::iterator_traits<ITE_T>::iterator_category>::value,
+      "parse_records() needs to jump around the data");
+
+  static_assert(std::is_same<std::decay_t<DST_T>, Nil>::value ||
+                    is_collection<DST_T>::value,
+                "parse_records() needs a collection as destination");
+
+  // Workers would all share the same cache.
+  static_assert(!uses_memo_cache<pattern_t<PAT_T>>::value &&
+                    !uses_memo_cache<pattern_t<SEP_T>>::value,
+                "memoize() cannot be used by parse_records()");
+}
+
+// Where the records of a chunk go.
+template <typename DST_T>
+using values_t =
+    std::conditional_t<std::is_same<std::decay_t<DST_T>, Nil>::value, Nil,
+                       DST_T>;
+
+// Moves everything in src from first on to the end of dst.
+template <typename DST_T, typename ITE_T>
+void append(DST_T& dst, DST_T& src, ITE_T first) {
+  dst.insert(dst.end(), std::make_move_iterator(first),
+             std::make_move_iterator(src.end()));
+}
+
+// Runs task(i, arena) for every i in [0, count), on up to thread_count
+// threads including the calling one, until stop() returns true. Tasks are
+// handed out in order, to whichever thread is available.
+template <typename TASK_T, typename STOP_T>
+void run_tasks(std::size_t count, std::size_t thread_count,
+               TASK_T const& task, STOP_T const& stop) {
+  std::atomic<std::size_t> next_task{0};
+
+  auto work = [&] {
+    Arena arena;
+    for (auto i = next_task++; i < count && !stop(); i = next_task++) {
+      task(i, arena);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < std::min(thread_count, count); ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& t : threads) {
+    t.join();
+  }
+}
+
+// A run of consecutive records, and what came out of them.
+template <typename ITE_T, typename DST_T>
+struct Chunk {
+  ITE_T begin;
+  ITE_T end;
+  DST_T values;
+};
+
+// Parses the whole of [b, e) as a single record.
+template <typename ITE_T, typename PAT_T, typename DST_T>
+bool parse_record(ITE_T b, ITE_T e, PAT_T const& pat, DST_T& dst,
+                  Arena& arena) {
+  auto real_dst = wrap_dst(dst);
+
+  constexpr std::size_t rollback_capacity =
+      2 * pattern_depth<PAT_T>::value;
+  using data_source_t = SingleForwardDataSource<ITE_T, rollback_capacity>;
+
+  data_source_t data(b, e);
+  Context<data_source_t, Fail, decltype(real_dst)> ctx(data, fail, real_dst,
+                                                       &arena);
+
+  return parse_direct<DefaultReqs>(ctx, real_dst, pat) == Result::SUCCESS &&
+         data.empty();
+}
+
+// Cuts [b, e) in about count pieces, right after separators. The result
+// holds the start of every piece, followed by e.
+template <typename ITE_T, typename SEP_T>
+std::vector<ITE_T> split(ITE_T b, ITE_T e, SEP_T const& sep,
+                         std::size_t count) {
+  using diff_t = typename std::iterator_traits<ITE_T>::difference_type;
+  auto step = std::max<diff_t>(1, (e - b) / diff_t(count));
+
+  std::vector<ITE_T> bounds = {b};
+  while (bounds.back() != e) {
+    ITE_T next = bounds.back() + std::min(step, e - bounds.back());
+    next = std::find(next, e, sep);
+    if (next != e) {
+      ++next;
+    }
+    bounds.push_back(next);
+  }
+  return bounds;
+}
+
+// Parses the record starting at b, which may run all the way to e. Returns
+// where the next record starts, or nothing if the record does not match pat
+// or is not followed by sep.
+template <typename ITE_T, typename PAT_T, typename SEP_T, typename DST_T>
+std::optional<ITE_T> parse_record_at(ITE_T b, ITE_T e, PAT_T const& pat,
+                                     SEP_T const& sep, DST_T& dst,
+                                     Arena& arena) {
+  auto real_dst = wrap_dst(dst);
+
+  constexpr std::size_t rollback_capacity =
+      2 * pattern_depth<PAT_T>::value;
+  using data_source_t = SingleForwardDataSource<ITE_T, rollback_capacity>;
+
+  data_source_t data(b, e);
+  Context<data_source_t, Fail, decltype(real_dst)> ctx(data, fail, real_dst,
+                                                       &arena);
+
+  if (parse_direct<DefaultReqs>(ctx, real_dst, pat) != Result::SUCCESS) {
+    return std::nullopt;
+  }
+
+  ITE_T record_e = e - data.size();
+  if (record_e == e) {
+    return e;
+  }
+  if (*record_e == sep) {
+    return std::next(record_e);
+  }
+  return std::nullopt;
+}
+
+// Same as parse_record_at(), appending the value of the record to values.
+template <typename ITE_T, typename PAT_T, typename SEP_T, typename VALUES_T>
+std::optional<ITE_T> parse_value_at(ITE_T b, ITE_T e, PAT_T const& pat,
+                                    SEP_T const& sep, VALUES_T& values,
+                                    Arena& arena) {
+  if constexpr (std::is_same<VALUES_T, Nil>::value) {
+    return parse_record_at(b, e, pat, sep, values, arena);
+  } else {
+    typename VALUES_T::value_type value;
+    auto next = parse_record_at(b, e, pat, sep, value, arena);
+    if (next) {
+      values.insert(values.end(), std::move(value));
+    }
+    return next;
+  }
+}
+
+// Consecutive records parsed ahead of time, from a guessed starting point.
+//  - starts holds the start of every record that was attempted.
+//  - If failed, the last record in starts did not parse, or threw error.
+template <typename ITE_T, typename DST_T>
+struct SpeculativeRun {
+  std::vector<ITE_T> starts;
+  DST_T values{};
+  bool failed = false;
+  std::exception_ptr error;
+};
+
+// Every run but the last one failed. If the last one did not, stop is where
+// the first record past limit starts.
+template <typename ITE_T, typename DST_T>
+struct SpeculativeChunk {
+  ITE_T begin;
+  ITE_T limit;
+  std::vector<SpeculativeRun<ITE_T, DST_T>> runs;
+  ITE_T stop;
+};
+}  // namespace records_
+
+// Parses a sequence of records, each of which is terminated by sep, except
+// maybe the last one. Every record must match pat in its entirety.
+//
+// Records are parsed independently from each other, on up to thread_count
+// threads, so sep must never appear within a record, and actions must be
+// safe to invoke concurrently.
+//
+// On success, dst, which must be a collection, receives the value of every
+// record in order. It is left untouched on failure. Passing nil as dst
+// simply checks the records.
+template <typename ITE_T, typename PAT_T, typename SEP_T, typename DST_T>
+Result parse_records(
+    ITE_T b, ITE_T e, const PAT_T& pat, SEP_T const& sep, DST_T& dst,
+    std::size_t thread_count = std::thread::hardware_concurrency()) {
+  records_::check_args<ITE_T, PAT_T, SEP_T, DST_T>();
+
+  using values_t = records_::values_t<DST_T>;
+  using chunk_t = records_::Chunk<ITE_T, values_t>;
+
+  auto real_pat = make_pattern(pat);
+  thread_count = std::max<std::size_t>(1, thread_count);
+
+  // Some records are costlier than others, so there are a few chunks per
+  // thread, and threads grab whichever chunk is next when they are done.
+  auto bounds = records_::split(b, e, sep, thread_count * 4);
+  std::vector<chunk_t> chunks;
+  for (std::size_t i = 1; i < bounds.size(); ++i) {
+    chunks.push_back({bounds[i - 1], bounds[i], values_t()});
+  }
+
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto parse_chunk = [&](std::size_t i, Arena& arena) {
+    auto& chunk = chunks[i];
+    try {
+      ITE_T record_b = chunk.begin;
+      while (record_b != chunk.end && !failed) {
+        ITE_T record_e = std::find(record_b, chunk.end, sep);
+
+        if constexpr (std::is_same<values_t, Nil>::value) {
+          if (!records_::parse_record(record_b, record_e, real_pat,
+                                      chunk.values, arena)) {
+            failed = true;
+          }
+        } else {
+          typename values_t::value_type value;
+          if (records_::parse_record(record_b, record_e, real_pat, value,
+                                     arena)) {
+            chunk.values.insert(chunk.values.end(), std::move(value));
+          } else {
+            failed = true;
+          }
+        }
+        record_b = record_e == chunk.end ? record_e : std::next(record_e);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      failed = true;
+    }
+  };
+
+  records_::run_tasks(chunks.size(), thread_count, parse_chunk,
+                      [&] { return bool(failed); });
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if (failed) {
+    return Result::FAILURE;
+  }
+
+  if constexpr (!std::is_same<values_t, Nil>::value) {
+    dst.clear();
+    for (auto& chunk : chunks) {
+      records_::append(dst, chunk.values, chunk.values.begin());
+    }
+  }
+  return Result::SUCCESS;
+}
+
+template <typename ITE_T, typename PAT_T, typename SEP_T>
+Result parse_records(ITE_T b, ITE_T e, const PAT_T& pat, SEP_T const& sep) {
+  return parse_records(b, e, pat, sep, nil);
+}
+
+// Same as parse_records(), except that sep may also appear within records,
+// for example in quoted CSV fields. This costs a bit more, and actions may
+// be invoked on data that turns out not to be a record.
+//
+// The data is still cut right after separators, and each chunk is parsed on
+// the guess that it starts with a record. Chunks are then checked in order:
+// as soon as the actual records of the data land on a record that the guess
+// went through, the rest of the chunk is known to be right. Otherwise, the
+// records are parsed again until that happens or the chunk is done.
+template <typename ITE_T, typename PAT_T, typename SEP_T, typename DST_T>
+Result parse_records_speculative(
+    ITE_T b, ITE_T e, const PAT_T& pat, SEP_T const& sep, DST_T& dst,
+    std::size_t thread_count = std::thread::hardware_concurrency()) {
+  records_::check_args<ITE_T, PAT_T, SEP_T, DST_T>();
+
+  using values_t = records_::values_t<DST_T>;
+  using chunk_t = records_::SpeculativeChunk<ITE_T, values_t>;
+
+  auto real_pat = make_pattern(pat);
+  thread_count = std::max<std::size_t>(1, thread_count);
+
+  auto bounds = records_::split(b, e, sep, thread_count * 4);
+  std::vector<chunk_t> chunks;
+  for (std::size_t i = 1; i < bounds.size(); ++i) {
+    chunks.push_back({bounds[i - 1], bounds[i], {}, bounds[i]});
+  }
+
+  // A failed guess only means that the guess was wrong, until proven
+  // otherwise. The next separator makes for another guess.
+  auto guess_chunk = [&](std::size_t i, Arena& arena) {
+    auto& chunk = chunks[i];
+    ITE_T record_b = chunk.begin;
+    while (record_b < chunk.limit) {
+      auto& run = chunk.runs.emplace_back();
+      while (record_b < chunk.limit) {
+        run.starts.push_back(record_b);
+        std::optional<ITE_T> next;
+        try {
+          next = records_::parse_value_at(record_b, e, real_pat, sep,
+                                          run.values, arena);
+        } catch (...) {
+          run.error = std::current_exception();
+        }
+
+        if (!next) {
+          run.failed = true;
+          record_b = std::find(record_b, chunk.limit, sep);
+          if (record_b != chunk.limit) {
+            ++record_b;
+          }
+          break;
+        }
+        record_b = *next;
+      }
+    }
+    chunk.stop = record_b;
+  };
+
+  records_::run_tasks(chunks.size(), thread_count, guess_chunk,
+                      [] { return false; });
+
+  Arena arena;
+  values_t result{};
+  ITE_T record_b = b;
+  for (auto& chunk : chunks) {
+    while (record_b < chunk.limit) {
+      auto run = chunk.runs.begin();
+      auto found = run->starts.end();
+      for (; run != chunk.runs.end(); ++run) {
+        found = std::lower_bound(run->starts.begin(), run->starts.end(),
+                                 record_b);
+        if (found != run->starts.end() && *found == record_b) {
+          break;
+        }
+      }
+
+      // The actual records joined a run, which holds everything up to the
+      // end of the chunk, or up to a real failure.
+      if (run != chunk.runs.end()) {
+        if (run->error) {
+          std::rethrow_exception(run->error);
+        }
+        if (run->failed) {
+          return Result::FAILURE;
+        }
+        if constexpr (!std::is_same<values_t, Nil>::value) {
+          records_::append(result, run->values,
+                           std::next(run->values.begin(),
+                                     found - run->starts.begin()));
+        }
+        record_b = chunk.stop;
+        break;
+      }
+
+      auto next =
+          records_::parse_value_at(record_b, e, real_pat, sep, result, arena);
+      if (!next) {
+        return Result::FAILURE;
+      }
+      record_b = *next;
+    }
+  }
+
+  if constexpr (!std::is_same<values_t, Nil>::value) {
+    dst = std::move(result);
+  }
+  return Result::SUCCESS;
+}
+
+template <typename ITE_T, typename PAT_T, typename SEP_T>
+Result parse_records_speculative(ITE_T b, ITE_T e, const PAT_T& pat,
+                                 SEP_T const& sep) {
+  return parse_records_speculative(b, e, pat, sep, nil);
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
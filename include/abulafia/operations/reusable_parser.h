@@ -0,0 +1,83 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_OPERATIONS_REUSABLE_PARSER_H_
+#define ABULAFIA_OPERATIONS_REUSABLE_PARSER_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/data_source/single_forward.h"
+#include "abulafia/dst_wrapper/select_wrapper.h"
+
+#include "abulafia/parsers/coroutine/parser_factory.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/leaf/fail.h"
+
+#include "abulafia/context.h"
+#include "abulafia/patterns/pattern.h"
+#include "abulafia/result.h"
+#include "abulafia/support/arena.h"
+#include "abulafia/support/nil.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Does the same thing as parse(), for many inputs in a row. The pattern is
+// only prepared once, and the memory used by recursive patterns is kept
+// around from one input to the next.
+//
+// A ReusableParser must not be used by several threads at once.
+template <typename PAT_T, typename DST_T = Nil>
+class ReusableParser {
+ public:
+  explicit ReusableParser(PAT_T const& pat) : pat_(pat) {}
+
+  template <typename ITE_T>
+  Result parse(ITE_T b, ITE_T e, DST_T& dst) {
+    auto real_dst = wrap_dst(dst);
+
+    constexpr std::size_t rollback_capacity =
+        2 * pattern_depth<PAT_T>::value;
+    using data_source_t = SingleForwardDataSource<ITE_T, rollback_capacity>;
+
+    // Whatever the previous input left in there is long gone.
+    arena_.release();
+
+    data_source_t data(b, e);
+    Context<data_source_t, Fail, decltype(real_dst)> ctx(data, fail, real_dst,
+                                                         &arena_);
+    return parse_direct<DefaultReqs>(ctx, real_dst, pat_);
+  }
+
+  template <typename ITE_T>
+  Result parse(ITE_T b, ITE_T e) {
+    static_assert(std::is_same<DST_T, Nil>::value,
+                  "this parser needs a destination");
+    return parse(b, e, nil);
+  }
+
+  PAT_T const& pattern() const { return pat_; }
+
+  // Where recursive patterns that can't be parsed directly keep their state.
+  Arena const& arena() const { return arena_; }
+
+ private:
+  PAT_T pat_;
+  Arena arena_;
+};
+
+template <typename DST_T = Nil, typename PAT_T>
+auto make_reusable_parser(PAT_T const& pat) {
+  return ReusableParser<decltype(make_pattern(pat)), DST_T>(
+      make_pattern(pat));
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parsers/coroutine/parser_factory.h"
+#include "abulafia/parsers/coroutine/reset.h"
 #include "abulafia/patterns/leaf/fail.h"
 #include "abulafia/result.h"
 #include "abulafia/support/nil.h"
@@ -12,6 +12,7 @@
 
 #include "abulafia/dst_wrapper/select_wrapper.h"
 #include "abulafia/parsers/coroutine/dst_behavior.h"
+#include "abulafia/parsers/coroutine/reset.h"
 #include "abulafia/result.h"
 
 namespace ABULAFIA_NAMESPACE {
@@ -37,6 +38,11 @@ class AtomicAdapter {
   AtomicAdapter(CTX_T ctx, DST_T, pat_t const& pat)
       : adapted_parser_(ctx, adapted_dst_t(buffer_), pat) {}
 
+  void reset(CTX_T ctx, DST_T, pat_t const& pat) {
+    reset_buffer(buffer_);
+    reset_parser(adapted_parser_, ctx, adapted_dst_t(buffer_), pat);
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     auto status = adapted_parser_.consume(ctx, adapted_dst_t(buffer_), pat);
     if (status == Result::SUCCESS) {
@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parsers/coroutine/dst_behavior.h"
+#include "abulafia/parsers/coroutine/reset.h"
 #include "abulafia/result.h"
 
 namespace ABULAFIA_NAMESPACE {
@@ -39,6 +40,11 @@ class CleanFailureAdapter {
     ctx.data().prepare_rollback();
   }
 
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser(adapted_parser_, ctx, dst, pat);
+    ctx.data().prepare_rollback();
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     auto status = adapted_parser_.consume(ctx, dst, pat);
     switch (status) {
@@ -0,0 +1,68 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_ADAPTERS_PROFILE_H_
+#define ABULAFIA_PARSERS_COROUTINE_ADAPTERS_PROFILE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/dst_behavior.h"
+#include "abulafia/parsers/coroutine/reset.h"
+#include "abulafia/result.h"
+#include "abulafia/support/profile.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+// Records the calls made to a parser in the profile entry of its pattern.
+// This is the outermost adapter, so that what is recorded is exactly what the
+// parent sees.
+template <typename CTX_T, typename DST_T, typename REQ_T,
+          typename PARSER_FACTORY_T>
+class ProfileAdapter {
+ public:
+  using pat_t = typename PARSER_FACTORY_T::pat_t;
+  using child_parser_t =
+      typename PARSER_FACTORY_T::template type<CTX_T, DST_T, REQ_T>;
+
+  ProfileAdapter(CTX_T ctx, DST_T dst, pat_t const& pat)
+      : adapted_parser_(ctx, dst, pat) {}
+
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser(adapted_parser_, ctx, dst, pat);
+  }
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    ProfileScope scope(profile_entry<pat_t>(), profile_remaining(ctx));
+    auto status = adapted_parser_.consume(ctx, dst, pat);
+    scope.finish(status, REQ_T::FAILS_CLEANLY, profile_remaining(ctx));
+    return status;
+  }
+
+ private:
+  child_parser_t adapted_parser_;
+};
+
+template <typename FACTORY_T>
+struct ProfileFactoryAdapter {
+  static constexpr DstBehavior dst_behavior() {
+    return FACTORY_T::dst_behavior();
+  }
+
+  using pat_t = typename FACTORY_T::pat_t;
+
+  enum {
+    ATOMIC = FACTORY_T::ATOMIC,
+    FAILS_CLEANLY = FACTORY_T::FAILS_CLEANLY,
+  };
+
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = ProfileAdapter<CTX_T, DST_T, REQ_T, FACTORY_T>;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -13,9 +13,13 @@
 #include "abulafia/context.h"
 #include "abulafia/dst_wrapper/select_wrapper.h"
 #include "abulafia/parsers/coroutine/dst_behavior.h"
+#include "abulafia/parsers/coroutine/reset.h"
+#include "abulafia/parsers/helpers/skip_chars.h"
 #include "abulafia/patterns/leaf/fail.h"
 #include "abulafia/result.h"
 
+#include <type_traits>
+
 namespace ABULAFIA_NAMESPACE {
 
 template <typename CTX_T, typename DST_T, typename REQ_T, typename PAT_T>
@@ -42,17 +46,21 @@ class SkipAdapter {
       Parser_t<skip_context_t, Nil, skip_req_t, typename CTX_T::skip_pattern_t>;
 
   SkipAdapter(CTX_T ctx, DST_T dst, pat_t const& pat)
-      : skip_parser_(skip_context_t(ctx.data(), fail, nil), nil, ctx.skipper()),
+      : skip_parser_(skip_ctx_(ctx), nil, ctx.skipper()),
         adapted_parser_(ctx, dst, pat) {}
 
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    skipping_done_ = false;
+    reset_parser(skip_parser_, skip_ctx_(ctx), nil, ctx.skipper());
+    reset_parser(adapted_parser_, ctx, dst, pat);
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     while (!skipping_done_) {
-      auto status = skip_parser_.consume(skip_context_t(ctx.data(), fail, nil),
-                                         nil, ctx.skipper());
+      auto status = skip_parser_.consume(skip_ctx_(ctx), nil, ctx.skipper());
       switch (status) {
         case Result::SUCCESS:
-          skip_parser_ = skip_parser_t(skip_context_t(ctx.data(), fail, nil),
-                                       nil, ctx.skipper());
+          reset_parser(skip_parser_, skip_ctx_(ctx), nil, ctx.skipper());
           break;
         case Result::FAILURE:
           skipping_done_ = true;
@@ -66,11 +74,48 @@ class SkipAdapter {
   }
 
  private:
+  static skip_context_t skip_ctx_(CTX_T ctx) {
+    return skip_context_t(ctx.data(), fail, nil, ctx.arena());
+  }
+
   bool skipping_done_ = false;
   skip_parser_t skip_parser_;
   child_parser_t adapted_parser_;
 };
 
+// Same thing, for skippers that skip_chars() can handle without a parser.
+template <typename CTX_T, typename DST_T, typename REQ_T,
+          typename PARSER_FACTORY_T>
+class CharSkipAdapter {
+ public:
+  using pat_t = typename PARSER_FACTORY_T::pat_t;
+
+  using child_parser_t =
+      typename PARSER_FACTORY_T::template type<CTX_T, DST_T, REQ_T>;
+
+  CharSkipAdapter(CTX_T ctx, DST_T dst, pat_t const& pat)
+      : adapted_parser_(ctx, dst, pat) {}
+
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    skipping_done_ = false;
+    reset_parser(adapted_parser_, ctx, dst, pat);
+  }
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    if (!skipping_done_) {
+      if (skip_chars(ctx) == Result::PARTIAL) {
+        return Result::PARTIAL;
+      }
+      skipping_done_ = true;
+    }
+    return adapted_parser_.consume(ctx, dst, pat);
+  }
+
+ private:
+  bool skipping_done_ = false;
+  child_parser_t adapted_parser_;
+};
+
 template <typename FACTORY_T>
 struct SkipFactoryAdapter {
   using pat_t = typename FACTORY_T::pat_t;
@@ -85,7 +130,10 @@ struct SkipFactoryAdapter {
   };
 
   template <typename CTX_T, typename DST_T, typename REQ_T>
-  using type = SkipAdapter<CTX_T, DST_T, REQ_T, FACTORY_T>;
+  using type = std::conditional_t<
+      skip_char_set<typename CTX_T::skip_pattern_t>::value,
+      CharSkipAdapter<CTX_T, DST_T, REQ_T, FACTORY_T>,
+      SkipAdapter<CTX_T, DST_T, REQ_T, FACTORY_T>>;
 };
 
 }  // namespace ABULAFIA_NAMESPACE
@@ -8,6 +8,7 @@
 #ifndef ABULAFIA_PARSERS_COROUTINES_ALL_H_
 #define ABULAFIA_PARSERS_COROUTINES_ALL_H_
 
+#include "abulafia/parsers/coroutine/leaf/numeric/float.h"
 #include "abulafia/parsers/coroutine/leaf/numeric/int.h"
 #include "abulafia/parsers/coroutine/leaf/numeric/uint.h"
 
@@ -15,9 +16,11 @@
 #include "abulafia/parsers/coroutine/leaf/character.h"
 #include "abulafia/parsers/coroutine/leaf/eoi.h"
 #include "abulafia/parsers/coroutine/leaf/fail.h"
+#include "abulafia/parsers/coroutine/leaf/hashed_symbol.h"
 #include "abulafia/parsers/coroutine/leaf/pass.h"
 #include "abulafia/parsers/coroutine/leaf/string_literal.h"
 #include "abulafia/parsers/coroutine/leaf/string_symbol.h"
+#include "abulafia/parsers/coroutine/leaf/token.h"
 
 #include "abulafia/parsers/coroutine/binary/except.h"
 #include "abulafia/parsers/coroutine/binary/list.h"
@@ -30,7 +33,9 @@
 #include "abulafia/parsers/coroutine/unary/construct.h"
 #include "abulafia/parsers/coroutine/unary/discard.h"
 #include "abulafia/parsers/coroutine/unary/lexeme.h"
+#include "abulafia/parsers/coroutine/unary/memoize.h"
 #include "abulafia/parsers/coroutine/unary/not.h"
+#include "abulafia/parsers/coroutine/unary/operators.h"
 #include "abulafia/parsers/coroutine/unary/optional.h"
 #include "abulafia/parsers/coroutine/unary/repeat.h"
 
@@ -48,6 +48,10 @@ class ExceptImpl {
   ExceptImpl(CTX_T ctx, DST_T, pat_t const& pat)
       : child_parsers_(std::in_place_index_t<0>(), ctx, nil, pat.neg()) {}
 
+  void reset(CTX_T ctx, DST_T, pat_t const& pat) {
+    reset_parser_at<0>(child_parsers_, ctx, nil, pat.neg());
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     if (child_parsers_.index() == 0) {
       auto res = std::get<0>(child_parsers_).consume(ctx, nil, pat.neg());
@@ -58,8 +62,7 @@ class ExceptImpl {
         case Result::SUCCESS:
           return Result::FAILURE;
         case Result::FAILURE:
-          child_parsers_ =
-              child_parsers_t(std::in_place_index_t<1>(), ctx, dst, pat.op());
+          child_parsers_.template emplace<1>(ctx, dst, pat.op());
       }
     }
     abu_assume(child_parsers_.index() == 1);
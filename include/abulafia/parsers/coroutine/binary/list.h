@@ -51,6 +51,11 @@ class ListImpl {
     ctx.data().prepare_rollback();
   }
 
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser_at<0>(child_parsers_, ctx, dst, pat.op());
+    ctx.data().prepare_rollback();
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     while (1) {
       if (child_parsers_.index() == 0) {
@@ -62,8 +67,7 @@ class ListImpl {
             ctx.data().cancel_rollback();
             ctx.data().prepare_rollback();
 
-            child_parsers_ = child_parsers_t(std::in_place_index_t<1>(), ctx,
-                                             nil, pat.sep());
+            child_parsers_.template emplace<1>(ctx, nil, pat.sep());
           } break;
           case Result::FAILURE:
             // this will cancel the consumption of the separator if there was
@@ -80,8 +84,7 @@ class ListImpl {
             std::get<1>(child_parsers_).consume(ctx, nil, pat.sep());
         switch (child_res) {
           case Result::SUCCESS:
-            child_parsers_ =
-                child_parsers_t(std::in_place_index_t<0>(), ctx, dst, pat.op());
+            child_parsers_.template emplace<0>(ctx, dst, pat.op());
             break;
           case Result::FAILURE:
             // rollback whatever the separator may have eaten
@@ -0,0 +1,104 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_HASHED_SYMBOL_H_
+#define ABULAFIA_PARSERS_COROUTINE_HASHED_SYMBOL_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parser.h"
+#include "abulafia/parsers/helpers/char_run.h"
+#include "abulafia/patterns/leaf/hashed_symbol.h"
+#include "abulafia/support/assert.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CTX_T, typename DST_T, typename CHAR_T, typename VAL_T,
+          typename TERM_T>
+class HashedSymbolImpl {
+  using pat_t = HashedSymbol<CHAR_T, VAL_T, TERM_T>;
+
+  // Only used when the token can span multiple buffers.
+  std::basic_string<CHAR_T> token_;
+
+ public:
+  HashedSymbolImpl(CTX_T, DST_T, pat_t const&) {}
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    auto const& map = pat.map();
+
+    if constexpr (CTX_T::IS_CONTIGUOUS &&
+                  std::is_same<typename CTX_T::datasource_t::value_type,
+                               CHAR_T>::value) {
+      // Resolve the token in place. Nothing past the longest key can
+      // produce a match, so there is no point scanning further.
+      auto data = ctx.data().remaining();
+      std::size_t limit = std::min(data.size(), map.max_key_length() + 1);
+      std::size_t len = scan_run(pat.token_chars(), data.data(), limit);
+
+      auto found = map.find(data.data(), len);
+      if (!found) {
+        return Result::FAILURE;
+      }
+      dst = *found;
+      ctx.data().advance(len);
+      return Result::SUCCESS;
+    }
+
+    while (true) {
+      if (ctx.data().empty()) {
+        if (!ctx.data().final_buffer()) {
+          return Result::PARTIAL;
+        }
+        break;
+      }
+
+      auto next = ctx.data().next();
+      if (!pat.token_chars().is_valid(next)) {
+        break;
+      }
+
+      if (token_.size() == map.max_key_length()) {
+        // Too long to be any of the keys.
+        return Result::FAILURE;
+      }
+      token_.push_back(next);
+      ctx.data().advance();
+    }
+
+    auto found = map.find(token_.data(), token_.size());
+    if (!found) {
+      return Result::FAILURE;
+    }
+    dst = *found;
+    return Result::SUCCESS;
+  }
+};
+
+template <typename CHAR_T, typename VAL_T, typename TERM_T>
+struct ParserFactory<HashedSymbol<CHAR_T, VAL_T, TERM_T>> {
+  using pat_t = HashedSymbol<CHAR_T, VAL_T, TERM_T>;
+
+  static constexpr DstBehavior dst_behavior() { return DstBehavior::VALUE; }
+
+  enum {
+    ATOMIC = true,
+    FAILS_CLEANLY = false,
+  };
+
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = HashedSymbolImpl<CTX_T, DST_T, CHAR_T, VAL_T, TERM_T>;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,262 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_FLOAT_H_
+#define ABULAFIA_PARSERS_COROUTINE_FLOAT_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parser.h"
+#include "abulafia/parsers/helpers/decimal_to_binary.h"
+#include "abulafia/parsers/helpers/parse_digits.h"
+#include "abulafia/patterns/leaf/numeric/float.h"
+#include "abulafia/support/assert.h"
+#include "abulafia/support/nil.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CTX_T, typename DST_T, typename T>
+class FloatImpl {
+ public:
+  using pat_t = Float<T>;
+
+  FloatImpl(CTX_T, DST_T, pat_t const&) {}
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const&) {
+    if constexpr (CTX_T::IS_CONTIGUOUS) {
+      // The whole number is available, so the exponent can be looked ahead
+      // without setting up a rollback.
+      auto data = ctx.data().remaining();
+      std::size_t i = 0;
+      std::size_t len = data.size();
+
+      if (i < len && (data[i] == '-' || data[i] == '+')) {
+        value_.negative = data[i] == '-';
+        ++i;
+      }
+
+      i += scan_mantissa_digits_(data.substr(i), false);
+      if (i < len && data[i] == '.') {
+        ++i;
+        i += scan_mantissa_digits_(data.substr(i), true);
+      }
+
+      if (mantissa_digits_ == 0) {
+        return Result::FAILURE;
+      }
+
+      if (i < len && (data[i] == 'e' || data[i] == 'E')) {
+        std::size_t j = i + 1;
+        if (j < len && (data[j] == '-' || data[j] == '+')) {
+          exp_neg_ = data[j] == '-';
+          ++j;
+        }
+        for (; j < len && is_digit_(data[j]); ++j) {
+          add_exponent_digit_(int(data[j] - '0'));
+        }
+        if (exp_digits_ != 0) {
+          i = j;
+        } else {
+          exp_neg_ = false;
+        }
+      }
+
+      ctx.data().advance(i);
+      return finish_(dst);
+    }
+
+    while (true) {
+      if (ctx.data().empty()) {
+        if (ctx.data().final_buffer()) {
+          end_exponent_(ctx);
+          return finish_(dst);
+        } else {
+          return Result::PARTIAL;
+        }
+      }
+
+      auto next = ctx.data().next();
+      switch (state_) {
+        case State::SIGN:
+          state_ = State::INTEGER;
+          if (next == '-' || next == '+') {
+            value_.negative = next == '-';
+            ctx.data().advance();
+          }
+          break;
+
+        case State::INTEGER:
+        case State::FRACTION:
+          if (is_digit_(next)) {
+            add_mantissa_digit_(int(next - '0'), state_ == State::FRACTION);
+            ctx.data().advance();
+          } else if (next == '.' && state_ == State::INTEGER) {
+            state_ = State::FRACTION;
+            ctx.data().advance();
+          } else if ((next == 'e' || next == 'E') && mantissa_digits_ != 0) {
+            // An exponent marker that is not followed by digits is not part
+            // of the number.
+            ctx.data().prepare_rollback();
+            ctx.data().advance();
+            state_ = State::EXPONENT_SIGN;
+          } else {
+            return finish_(dst);
+          }
+          break;
+
+        case State::EXPONENT_SIGN:
+          state_ = State::EXPONENT;
+          if (next == '-' || next == '+') {
+            exp_neg_ = next == '-';
+            ctx.data().advance();
+          }
+          break;
+
+        case State::EXPONENT:
+          if (is_digit_(next)) {
+            add_exponent_digit_(int(next - '0'));
+            ctx.data().advance();
+          } else {
+            end_exponent_(ctx);
+            return finish_(dst);
+          }
+          break;
+      }
+    }
+  }
+
+ private:
+  enum class State { SIGN, INTEGER, FRACTION, EXPONENT_SIGN, EXPONENT };
+
+  // Beyond this many digits, the lowest ones cannot change the result.
+  static constexpr std::size_t max_kept_digits = 800;
+
+  // Exponents are clamped there, which is way past the range of any T.
+  static constexpr std::int64_t max_exponent = 100000;
+
+  template <typename CHAR_T>
+  static bool is_digit_(CHAR_T c) {
+    return c >= '0' && c <= '9';
+  }
+
+  template <typename VIEW_T>
+  std::size_t scan_mantissa_digits_(VIEW_T data, bool fractional) {
+    std::size_t i = 0;
+
+    if constexpr (swar_::enabled && sizeof(typename VIEW_T::value_type) == 1) {
+      // Groups of 8 digits, for as long as the mantissa keeps 19 digits or
+      // less.
+      auto ptr = reinterpret_cast<char const*>(data.data());
+      std::uint32_t chunk;
+      while (i + 8 <= data.size() && value_.mantissa < 100000000000ULL &&
+             swar_::parse_8_dec(ptr + i, chunk)) {
+        value_.mantissa = value_.mantissa * 100000000 + chunk;
+        if (fractional) {
+          value_.exponent -= 8;
+        }
+        mantissa_digits_ += 8;
+        i += 8;
+      }
+    }
+
+    for (; i < data.size() && is_digit_(data[i]); ++i) {
+      add_mantissa_digit_(int(data[i] - '0'), fractional);
+    }
+    return i;
+  }
+
+  void add_mantissa_digit_(int d, bool fractional) {
+    ++mantissa_digits_;
+
+    if (value_.mantissa < 1000000000000000000ULL) {
+      value_.mantissa = value_.mantissa * 10 + std::uint64_t(d);
+      if (fractional) {
+        --value_.exponent;
+      }
+      return;
+    }
+
+    // The mantissa is full, keep the digit aside for the slow path.
+    if (!fractional) {
+      ++value_.exponent;
+    }
+    if (value_.dropped_digits == 0) {
+      value_.digits = std::to_string(value_.mantissa);
+    }
+    if (value_.digits.size() < max_kept_digits) {
+      value_.digits.push_back(char('0' + d));
+      ++value_.dropped_digits;
+    } else if (d != 0 && value_.digits.back() == '0') {
+      // Make sure the kept digits do not land on a tie.
+      value_.digits.back() = '1';
+    }
+    if (d != 0) {
+      value_.truncated = true;
+    }
+  }
+
+  void add_exponent_digit_(int d) {
+    ++exp_digits_;
+    if (exp_ < max_exponent) {
+      exp_ = exp_ * 10 + d;
+    }
+  }
+
+  void end_exponent_(CTX_T ctx) {
+    if (state_ == State::EXPONENT_SIGN || state_ == State::EXPONENT) {
+      if (exp_digits_ == 0) {
+        ctx.data().commit_rollback();
+        exp_neg_ = false;
+      } else {
+        ctx.data().cancel_rollback();
+      }
+    }
+  }
+
+  Result finish_(DST_T dst) {
+    if (mantissa_digits_ == 0) {
+      return Result::FAILURE;
+    }
+
+    value_.exponent += exp_neg_ ? -exp_ : exp_;
+    if constexpr (!std::is_same<typename DST_T::dst_value_type, Nil>::value) {
+      dst.get() = decimal_to_binary<T>(value_);
+    }
+    return Result::SUCCESS;
+  }
+
+  DecimalFloat value_;
+  State state_ = State::SIGN;
+  std::size_t mantissa_digits_ = 0;
+  std::int64_t exp_ = 0;
+  int exp_digits_ = 0;
+  bool exp_neg_ = false;
+};
+
+template <typename T>
+struct ParserFactory<Float<T>> {
+  using pat_t = Float<T>;
+
+  static constexpr DstBehavior dst_behavior() { return DstBehavior::VALUE; }
+
+  enum {
+    ATOMIC = false,
+    FAILS_CLEANLY = false,
+  };
+
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = FloatImpl<CTX_T, DST_T, T>;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
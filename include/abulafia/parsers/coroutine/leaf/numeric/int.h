@@ -12,9 +12,12 @@
 
 #include "abulafia/parser.h"
 #include "abulafia/parsers/helpers/digit_values.h"
+#include "abulafia/parsers/helpers/parse_digits.h"
 #include "abulafia/patterns/leaf/numeric/int.h"
 #include "abulafia/support/assert.h"
 
+#include <cstddef>
+
 namespace ABULAFIA_NAMESPACE {
 
 template <typename CTX_T, typename DST_T, int BASE, int DIGITS_MIN,
@@ -28,12 +31,38 @@ class IntImpl {
   IntImpl(CTX_T, DST_T dst, pat_t const&) { dst.get() = 0; }
 
   Result consume(CTX_T ctx, DST_T dst, pat_t const&) {
+    if constexpr (CTX_T::IS_CONTIGUOUS) {
+      auto remaining = ctx.data().remaining();
+      std::size_t sign_len = 0;
+      if (look_for_sign_ && !remaining.empty()) {
+        look_for_sign_ = false;
+        if (remaining[0] == '-') {
+          neg_ = true;
+          sign_len = 1;
+        } else if (remaining[0] == '+') {
+          sign_len = 1;
+        }
+      }
+      remaining.remove_prefix(sign_len);
+
+      std::size_t max_count = remaining.size();
+      if (DIGITS_MAX != 0) {
+        max_count = DIGITS_MAX - digit_count_;
+      }
+
+      std::size_t count = 0;
+      if (!parse_digits<BASE>(remaining, max_count, dst.get(), neg_, count)) {
+        return Result::FAILURE;
+      }
+
+      ctx.data().advance(sign_len + count);
+      digit_count_ += int(count);
+      return digit_count_ >= DIGITS_MIN ? Result::SUCCESS : Result::FAILURE;
+    }
+
     while (true) {
       if (ctx.data().empty()) {
         if (ctx.data().final_buffer()) {
-          if (neg_) {
-            dst.get() *= -1;
-          }
           return digit_count_ >= DIGITS_MIN ? Result::SUCCESS : Result::FAILURE;
         } else {
           return Result::PARTIAL;
@@ -56,22 +85,19 @@ class IntImpl {
       }
 
       if (digit_vals::is_valid(next)) {
-        dst.get() *= BASE;
-        dst.get() += digit_vals::value(next);
+        // Negative values are accumulated downwards, so that the lowest
+        // value of the destination type can be reached.
+        if (!append_digits(dst.get(), BASE, digit_vals::value(next), neg_)) {
+          return Result::FAILURE;
+        }
 
         ++digit_count_;
         ctx.data().advance();
 
         if (digit_count_ == DIGITS_MAX) {
-          if (neg_) {
-            dst.get() *= -1;
-          }
           return Result::SUCCESS;
         }
       } else {
-        if (neg_) {
-          dst.get() *= -1;
-        }
         return digit_count_ >= DIGITS_MIN ? Result::SUCCESS : Result::FAILURE;
       }
     }
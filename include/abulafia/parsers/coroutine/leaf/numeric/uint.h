@@ -12,9 +12,12 @@
 
 #include "abulafia/parser.h"
 #include "abulafia/parsers/helpers/digit_values.h"
+#include "abulafia/parsers/helpers/parse_digits.h"
 #include "abulafia/patterns/leaf/numeric/uint.h"
 #include "abulafia/support/assert.h"
 
+#include <cstddef>
+
 namespace ABULAFIA_NAMESPACE {
 
 template <typename CTX_T, typename DST_T, int BASE, int DIGITS_MIN,
@@ -28,6 +31,24 @@ class UIntImpl {
   UIntImpl(CTX_T, DST_T dst, pat_t const&) { dst.get() = 0; }
 
   Result consume(CTX_T ctx, DST_T dst, pat_t const&) {
+    if constexpr (CTX_T::IS_CONTIGUOUS) {
+      // Scan the digit run in one go, and consume it all at once.
+      auto remaining = ctx.data().remaining();
+      std::size_t max_count = remaining.size();
+      if (DIGITS_MAX != 0) {
+        max_count = DIGITS_MAX - digit_count_;
+      }
+
+      std::size_t count = 0;
+      if (!parse_digits<BASE>(remaining, max_count, dst.get(), false, count)) {
+        return Result::FAILURE;
+      }
+
+      ctx.data().advance(count);
+      digit_count_ += int(count);
+      return digit_count_ >= DIGITS_MIN ? Result::SUCCESS : Result::FAILURE;
+    }
+
     while (true) {
       if (ctx.data().empty()) {
         if (ctx.data().final_buffer()) {
@@ -39,8 +60,9 @@ class UIntImpl {
 
       auto next = ctx.data().next();
       if (digit_vals::is_valid(next)) {
-        dst.get() *= typename DST_T::dst_value_type(BASE);
-        dst.get() += digit_vals::value(next);
+        if (!append_digits(dst.get(), BASE, digit_vals::value(next), false)) {
+          return Result::FAILURE;
+        }
 
         ++digit_count_;
         ctx.data().advance();
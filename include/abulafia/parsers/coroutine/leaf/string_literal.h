@@ -14,6 +14,8 @@
 #include "abulafia/patterns/leaf/string_literal.h"
 #include "abulafia/support/assert.h"
 
+#include <algorithm>
+#include <iterator>
 #include <variant>
 
 namespace ABULAFIA_NAMESPACE {
@@ -28,6 +30,20 @@ class StringLiteralImpl {
       : next_expected_(pat.begin()) {}
 
   Result consume(CTX_T ctx, DST_T, PAT_T const& pat) {
+    if constexpr (CTX_T::IS_CONTIGUOUS) {
+      // The whole literal is either there or not.
+      auto remaining = ctx.data().remaining();
+      decltype(next_expected_) expected_end = pat.end();
+      std::size_t len = std::distance(next_expected_, expected_end);
+      if (remaining.size() < len ||
+          !std::equal(next_expected_, expected_end, remaining.begin())) {
+        return Result::FAILURE;
+      }
+      ctx.data().advance(len);
+      next_expected_ = expected_end;
+      return Result::SUCCESS;
+    }
+
     while (1) {
       if (next_expected_ == pat.end()) {
         return Result::SUCCESS;
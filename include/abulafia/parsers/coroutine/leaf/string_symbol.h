@@ -14,27 +14,57 @@
 #include "abulafia/patterns/leaf/string_symbol.h"
 #include "abulafia/support/assert.h"
 
-#include <variant>
+#include <cstddef>
 
 namespace ABULAFIA_NAMESPACE {
 
 template <typename CTX_T, typename DST_T, typename CHAR_T, typename VAL_T>
 class SymbolImpl {
   using pat_t = Symbol<CHAR_T, VAL_T>;
-  using node_t = typename pat_t::node_t;
+  using trie_t = typename pat_t::trie_t;
+  using node_id = typename trie_t::node_id;
 
-  node_t const* next_ = nullptr;
-  node_t const* current_valid_ = nullptr;
+  node_id next_;
+  node_id current_valid_ = trie_t::npos;
 
  public:
-  SymbolImpl(CTX_T, DST_T, pat_t const& pat) : next_(pat.root()) {}
+  SymbolImpl(CTX_T, DST_T, pat_t const& pat) : next_(pat.trie().root()) {}
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    trie_t const& trie = pat.trie();
+
+    if constexpr (CTX_T::IS_CONTIGUOUS) {
+      // Walk the trie over the remaining data directly, and only consume
+      // the longest match.
+      auto data = ctx.data().remaining();
+      std::size_t match_len = 0;
+      for (std::size_t i = 0; i < data.size(); ++i) {
+        next_ = trie.child(next_, data[i]);
+        if (next_ == trie_t::npos) {
+          break;
+        }
+        if (trie.has_value(next_)) {
+          current_valid_ = next_;
+          match_len = i + 1;
+        }
+        if (trie.is_leaf(next_)) {
+          break;
+        }
+      }
+
+      if (current_valid_ == trie_t::npos) {
+        return Result::FAILURE;
+      }
+      dst = trie.value(current_valid_);
+      ctx.data().advance(match_len);
+      return Result::SUCCESS;
+    }
 
-  Result consume(CTX_T ctx, DST_T dst, pat_t const&) {
     while (1) {
       if (ctx.data().empty()) {
         if (ctx.data().final_buffer()) {
-          if (current_valid_) {
-            dst = *current_valid_->val;
+          if (current_valid_ != trie_t::npos) {
+            dst = trie.value(current_valid_);
             ctx.data().commit_rollback();
             return Result::SUCCESS;
           } else {
@@ -47,13 +77,12 @@ class SymbolImpl {
         }
       }
 
-      auto next = ctx.data().next();
-      auto found = next_->child.find(next);
-      if (found == next_->child.end()) {
+      auto found = trie.child(next_, ctx.data().next());
+      if (found == trie_t::npos) {
         // the next character leads nowhere
-        if (current_valid_) {
+        if (current_valid_ != trie_t::npos) {
           // we had a match along the way
-          dst = *current_valid_->val;
+          dst = trie.value(current_valid_);
           ctx.data().commit_rollback();
           return Result::SUCCESS;
         }
@@ -61,16 +90,16 @@ class SymbolImpl {
       } else {
         // consume the value
         ctx.data().advance();
-        next_ = &found->second;
-        if (next_->val) {
+        next_ = found;
+        if (trie.has_value(next_)) {
           // we got a hit!
-          if (current_valid_) {
+          if (current_valid_ != trie_t::npos) {
             ctx.data().cancel_rollback();
           }
 
-          if (next_->child.empty()) {
+          if (trie.is_leaf(next_)) {
             // nowhere to go from here
-            dst = *next_->val;
+            dst = trie.value(next_);
             return Result::SUCCESS;
           }
           current_valid_ = next_;
@@ -0,0 +1,54 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_TOKEN_H_
+#define ABULAFIA_PARSERS_COROUTINE_TOKEN_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parser.h"
+#include "abulafia/patterns/leaf/token.h"
+
+namespace ABULAFIA_NAMESPACE {
+template <typename CTX_T, typename DST_T>
+class TokImpl {
+ public:
+  using pat_t = Tok;
+  TokImpl(CTX_T, DST_T, pat_t const&) {}
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    if (ctx.data().empty()) {
+      return ctx.data().final_buffer() ? Result::FAILURE : Result::PARTIAL;
+    }
+
+    auto const& next = ctx.data().next();
+    if (next.kind == pat.kind()) {
+      dst = next.text;
+      ctx.data().advance();
+      return Result::SUCCESS;
+    }
+    return Result::FAILURE;
+  }
+};
+
+template <>
+struct ParserFactory<Tok> {
+  using pat_t = Tok;
+
+  static constexpr DstBehavior dst_behavior() { return DstBehavior::VALUE; }
+
+  enum {
+    ATOMIC = true,
+    FAILS_CLEANLY = true,
+  };
+
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = TokImpl<CTX_T, DST_T>;
+};
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -11,9 +11,12 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/parsers/helpers/skip_chars.h"
 #include "abulafia/patterns/nary/alternative.h"
 #include "abulafia/support/visit_val.h"
 
+#include <cstdint>
+#include <type_traits>
 #include <variant>
 
 namespace ABULAFIA_NAMESPACE {
@@ -60,16 +63,32 @@ class AltImpl {
       CTX_T, DST_T, child_req_t, childs_tuple_t,
       std::index_sequence_for<CHILD_PATS_T...>>::type;
 
+  using value_type = decay_t<typename CTX_T::datasource_t::value_type>;
+
+  // The dispatch table can only be used if the next character in the data is
+  // the first one the childs will see.
+  static constexpr bool can_dispatch =
+      sizeof(value_type) == 1 && !CTX_T::HAS_SKIPPER;
+
+  // Set when the current child is the only one that can possibly match.
+  bool committed_;
   child_parsers_t child_parsers_;
 
  public:
   AltImpl(CTX_T ctx, DST_T dst, pat_t const& pat)
-      : child_parsers_(std::in_place_index_t<0>(),
-                       std::variant_alternative_t<0, child_parsers_t>(
-                           ctx, dst, getChild<0>(pat))) {}
+      : AltImpl(ctx, dst, pat, first_branch_(ctx, pat)) {}
+
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    auto branch = first_branch_(ctx, pat);
+    committed_ = (branch & pat_t::unique_branch) != 0;
+    visit_val<sizeof...(CHILD_PATS_T)>(
+        branch & ~pat_t::unique_branch, [&](auto N) {
+          reset_parser_at<N()>(child_parsers_, ctx, dst, getChild<N()>(pat));
+        });
+  }
 
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
-    if (CTX_T::IS_RESUMABLE) {
+    if (CTX_T::IS_RESUMABLE || child_parsers_.index() != 0) {
       return visit_val<sizeof...(CHILD_PATS_T)>(
           child_parsers_.index(),
           [&](auto N) { return this->consume_from<N()>(ctx, dst, pat); });
@@ -91,23 +110,47 @@ class AltImpl {
     if (Result::FAILURE == child_res) {
       constexpr int next_id = ID + 1;
 
-      // if we have reached the end of the child parsers list
-      if (sizeof...(CHILD_PATS_T) == next_id) {
+      // if we have reached the end of the child parsers list, or if none of
+      // the remaining ones can match.
+      if (sizeof...(CHILD_PATS_T) == next_id || committed_) {
         return Result::FAILURE;
       } else {
         constexpr int new_id = next_id < sizeof...(CHILD_PATS_T) ? next_id : 0;
         auto const& new_c_pattern = getChild<new_id>(pat);
 
-        child_parsers_ = child_parsers_t(std::in_place_index_t<new_id>(), ctx,
-                                         dst, new_c_pattern);
+        child_parsers_.template emplace<new_id>(ctx, dst, new_c_pattern);
 
         return consume_from<new_id>(ctx, dst, pat);
       }
     }
     return child_res;
   }
+
+ private:
+  AltImpl(CTX_T ctx, DST_T dst, pat_t const& pat, std::uint8_t branch)
+      : committed_((branch & pat_t::unique_branch) != 0),
+        child_parsers_(visit_val<sizeof...(CHILD_PATS_T)>(
+            branch & ~pat_t::unique_branch, [&](auto N) {
+              return child_parsers_t(std::in_place_index_t<N()>(), ctx, dst,
+                                     getChild<N()>(pat));
+            })) {}
+
+  // Looks up the child to start from, if the first character is available.
+  static std::uint8_t first_branch_(CTX_T ctx, pat_t const& pat) {
+    if constexpr (can_dispatch) {
+      auto table = pat.dispatch_table();
+      if (table && !ctx.data().empty()) {
+        return (*table)[std::uint8_t(ctx.data().next())];
+      }
+    }
+    return 0;
+  }
 };
 
+// Whichever child gets parsed skips on its own.
+template <typename... CHILD_PATS_T>
+struct skips_in_childs<Alt<CHILD_PATS_T...>> : public std::true_type {};
+
 template <typename... CHILD_PATS_T>
 struct ParserFactory<Alt<CHILD_PATS_T...>> {
   using pat_t = Alt<CHILD_PATS_T...>;
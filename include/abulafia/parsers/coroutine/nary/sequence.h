@@ -11,9 +11,11 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/parsers/helpers/skip_chars.h"
 #include "abulafia/patterns/nary/sequence.h"
 #include "abulafia/support/visit_val.h"
 
+#include <type_traits>
 #include <variant>
 
 namespace ABULAFIA_NAMESPACE {
@@ -123,6 +125,11 @@ class SeqImpl {
     //    reset_if_collection<DST_T>::exec(dst);
   }
 
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser_at<0>(child_parsers_, ctx, getDstFor<0>(dst),
+                       getChild<0>(pat));
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     if (CTX_T::IS_RESUMABLE) {
       return visit_val<sizeof...(CHILD_PATS_T)>(
@@ -157,8 +164,8 @@ class SeqImpl {
         constexpr int new_id = next_id < sizeof...(CHILD_PATS_T) ? next_id : 0;
         auto const& new_c_pattern = getChild<new_id>(pat);
 
-        child_parsers_ = child_parsers_t(std::in_place_index_t<new_id>(), ctx,
-                                         getDstFor<new_id>(dst), new_c_pattern);
+        child_parsers_.template emplace<new_id>(ctx, getDstFor<new_id>(dst),
+                                                new_c_pattern);
 
         return consume_from<new_id>(ctx, dst, pat);
       }
@@ -167,6 +174,10 @@ class SeqImpl {
   }
 };
 
+// Every child skips before it is parsed, the first one included.
+template <typename... CHILD_PATS_T>
+struct skips_in_childs<Seq<CHILD_PATS_T...>> : public std::true_type {};
+
 template <typename... CHILD_PATS_T>
 struct ParserFactory<Seq<CHILD_PATS_T...>> {
   using pat_t = Seq<CHILD_PATS_T...>;
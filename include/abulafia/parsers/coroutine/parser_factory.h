@@ -18,6 +18,7 @@
 
 #include "abulafia/parsers/coroutine/adapters/atomic.h"
 #include "abulafia/parsers/coroutine/adapters/clean_failure.h"
+#include "abulafia/parsers/coroutine/adapters/profile.h"
 #include "abulafia/parsers/coroutine/adapters/skip.h"
 
 namespace ABULAFIA_NAMESPACE {
@@ -82,7 +83,8 @@ struct AdaptedParserFactory {
     constexpr bool apply_atomic_adapter = REQ_T::ATOMIC && !raw_factory::ATOMIC;
     constexpr bool apply_clean_failure_adapter =
         REQ_T::FAILS_CLEANLY && !raw_factory::FAILS_CLEANLY;
-    constexpr bool apply_skipper_adapter = !std::is_same<skip_t, Fail>::value;
+    constexpr bool apply_skipper_adapter =
+        !std::is_same<skip_t, Fail>::value && !skips_in_childs<PAT_T>::value;
 
     using a = raw_factory;
     using b =
@@ -91,10 +93,12 @@ struct AdaptedParserFactory {
                                    apply_clean_failure_adapter>;
     using d =
         ConditionalAdapter_t<c, SkipFactoryAdapter, apply_skipper_adapter>;
+    using e =
+        ConditionalAdapter_t<d, ProfileFactoryAdapter, profiling_enabled>;
 
     // TODO: Apply skipper here.
 
-    using parser_type = typename d::template type<CTX_T, DST_T, REQ_T>;
+    using parser_type = typename e::template type<CTX_T, DST_T, REQ_T>;
     return parser_type(ctx, dst, pat);
   }
 };
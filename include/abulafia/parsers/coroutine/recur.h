@@ -12,6 +12,7 @@
 
 #include "abulafia/parser.h"
 #include "abulafia/patterns/recur.h"
+#include "abulafia/support/arena.h"
 
 namespace ABULAFIA_NAMESPACE {
 
@@ -27,7 +28,11 @@ class RecurImpl {
 
   using operand_parser_t = Parser<CTX_T, DST_T, RecurChildReqs, operand_pat_t>;
 
-  std::unique_ptr<operand_parser_t> child_parser_;
+  arena_ptr<operand_parser_t> child_parser_;
+
+  // Set by reset(). The child parser is kept around, but only reset once it
+  // is needed, just like it is only created once it is needed.
+  bool stale_ = false;
 
  public:
   RecurImpl(CTX_T, DST_T, pat_t const&) {
@@ -35,11 +40,16 @@ class RecurImpl {
     // process.
   }
 
+  void reset(CTX_T, DST_T, pat_t const&) { stale_ = true; }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     if (!child_parser_) {
-      child_parser_ =
-          std::make_unique<operand_parser_t>(ctx, dst, pat.operand().impl);
+      child_parser_ = make_arena_ptr<operand_parser_t>(ctx.arena(), ctx, dst,
+                                                       pat.operand().impl);
+    } else if (stale_) {
+      reset_parser(*child_parser_, ctx, dst, pat.operand().impl);
     }
+    stale_ = false;
     return child_parser_->consume(ctx, dst, pat.operand().impl);
   }
 };
@@ -0,0 +1,74 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_RESET_H_
+#define ABULAFIA_PARSERS_COROUTINE_RESET_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/support/type_traits.h"
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace ABULAFIA_NAMESPACE {
+
+namespace reset_ {
+template <typename PARSER_T, typename CTX_T, typename DST_T, typename PAT_T,
+          typename ENABLE = void>
+struct has_reset : public std::false_type {};
+
+template <typename PARSER_T, typename CTX_T, typename DST_T, typename PAT_T>
+struct has_reset<PARSER_T, CTX_T, DST_T, PAT_T,
+                 std::void_t<decltype(std::declval<PARSER_T&>().reset(
+                     std::declval<CTX_T>(), std::declval<DST_T>(),
+                     std::declval<PAT_T const&>()))>> : public std::true_type {
+};
+}  // namespace reset_
+
+// Puts a parser that has returned SUCCESS or FAILURE back in the state it
+// would be in if it had just been constructed with the same arguments.
+//
+// Parsers that own child parsers provide a reset() member that reuses the
+// whole parser tree in place. Anything else has little enough state that it
+// is simply rebuilt.
+template <typename PARSER_T, typename CTX_T, typename DST_T, typename PAT_T>
+void reset_parser(PARSER_T& parser, CTX_T ctx, DST_T dst, PAT_T const& pat) {
+  if constexpr (reset_::has_reset<PARSER_T, CTX_T, DST_T, PAT_T>::value) {
+    parser.reset(ctx, dst, pat);
+  } else {
+    parser = PARSER_T(ctx, dst, pat);
+  }
+}
+
+// Same thing, for the ID-th alternative of a variant of parsers. Switching to
+// a different alternative constructs it in place.
+template <std::size_t ID, typename... PARSERS_T, typename CTX_T,
+          typename DST_T, typename PAT_T>
+void reset_parser_at(std::variant<PARSERS_T...>& parsers, CTX_T ctx, DST_T dst,
+                     PAT_T const& pat) {
+  if (parsers.index() == ID) {
+    reset_parser(std::get<ID>(parsers), ctx, dst, pat);
+  } else {
+    parsers.template emplace<ID>(ctx, dst, pat);
+  }
+}
+
+// Empties a buffer, but holds on to the memory of collections.
+template <typename T>
+void reset_buffer(T& buffer) {
+  if constexpr (is_collection<T>::value) {
+    buffer.clear();
+  } else {
+    buffer = T();
+  }
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -179,6 +179,11 @@ class ActionImpl {
   ActionImpl(CTX_T ctx, DST_T, PAT_T const& pat)
       : child_parser_(ctx, wrap_dst(landing), pat.child_pattern()) {}
 
+  void reset(CTX_T ctx, DST_T, PAT_T const& pat) {
+    reset_buffer(landing);
+    reset_parser(child_parser_, ctx, wrap_dst(landing), pat.child_pattern());
+  }
+
   Result consume(CTX_T ctx, DST_T dst, PAT_T const& pat) {
     auto status =
         child_parser_.consume(ctx, wrap_dst(landing), pat.child_pattern());
@@ -32,12 +32,19 @@ class BindDstImpl {
 
  public:
   BindDstImpl(CTX_T ctx, DST_T dst, pat_t const& pat)
-      : parser_(sub_ctx_t(ctx.data(), ctx.skipper(), dst), dst, pat.operand()) {
+      : parser_(sub_ctx_t(ctx.data(), ctx.skipper(), dst, ctx.arena()), dst,
+                pat.operand()) {}
+
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser(parser_,
+                 sub_ctx_t(ctx.data(), ctx.skipper(), dst, ctx.arena()), dst,
+                 pat.operand());
   }
 
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
-    return parser_.consume(sub_ctx_t(ctx.data(), ctx.skipper(), dst), dst,
-                           pat.operand());
+    return parser_.consume(
+        sub_ctx_t(ctx.data(), ctx.skipper(), dst, ctx.arena()), dst,
+        pat.operand());
   }
 };
 
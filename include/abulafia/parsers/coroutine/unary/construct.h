@@ -37,6 +37,11 @@ class ConstructImpl {
   ConstructImpl(CTX_T ctx, DST_T, pat_t const& pat)
       : parser_(ctx, child_dst_t(buffer_), pat.child_pattern()) {}
 
+  void reset(CTX_T ctx, DST_T, pat_t const& pat) {
+    reset_buffer(buffer_);
+    reset_parser(parser_, ctx, child_dst_t(buffer_), pat.child_pattern());
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     auto status =
         parser_.consume(ctx, child_dst_t(buffer_), pat.child_pattern());
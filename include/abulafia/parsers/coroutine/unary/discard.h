@@ -30,6 +30,10 @@ class DiscardImpl {
   DiscardImpl(ctx_t ctx, dst_t, pat_t const& pat)
       : child_parser_(ctx, nil, pat.operand()) {}
 
+  void reset(ctx_t ctx, dst_t, pat_t const& pat) {
+    reset_parser(child_parser_, ctx, nil, pat.operand());
+  }
+
   Result consume(ctx_t ctx, dst_t, pat_t const& pat) {
     return child_parser_.consume(ctx, nil, pat.operand());
   }
@@ -27,14 +27,23 @@ class LexemeImpl {
 
  public:
   LexemeImpl(CTX_T ctx, DST_T dst, pat_t const& pat)
-      : parser_(sub_ctx_t(ctx.data(), fail, ctx.bound_dst()), dst, pat.operand()) {}
+      : parser_(sub_ctx_(ctx), dst, pat.operand()) {}
+
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser(parser_, sub_ctx_(ctx), dst, pat.operand());
+  }
 
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
-    return parser_.consume(sub_ctx_t(ctx.data(), fail, ctx.bound_dst()), dst, pat.operand());
+    return parser_.consume(sub_ctx_(ctx), dst, pat.operand());
   }
 
   Result peek(CTX_T ctx, pat_t const& pat) {
-    return parser_.peek(sub_ctx_t(ctx.data(), fail, ctx.bound_dst()), pat.operand());
+    return parser_.peek(sub_ctx_(ctx), pat.operand());
+  }
+
+ private:
+  static sub_ctx_t sub_ctx_(CTX_T ctx) {
+    return sub_ctx_t(ctx.data(), fail, ctx.bound_dst(), ctx.arena());
   }
 };
 
@@ -43,7 +52,7 @@ struct ParserFactory<Lexeme<CHILD_PAT_T>> {
   using pat_t = Lexeme<CHILD_PAT_T>;
 
   static constexpr DstBehavior dst_behavior() {
-    return ParserFactory<CHILD_PAT_T>::CHILD_PAT_T::dst_behavior();
+    return ParserFactory<CHILD_PAT_T>::dst_behavior();
   }
 
   enum {
@@ -0,0 +1,147 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_MEMOIZE_H_
+#define ABULAFIA_PARSERS_COROUTINE_MEMOIZE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/dst_wrapper/select_wrapper.h"
+#include "abulafia/parser.h"
+#include "abulafia/patterns/unary/memoize.h"
+#include "abulafia/support/memo_cache.h"
+#include "abulafia/support/nil.h"
+
+#include <any>
+#include <optional>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CTX_T, typename DST_T, typename REQ_T, typename CHILD_PAT_T>
+class MemoizeImpl {
+  using pat_t = Memoize<CHILD_PAT_T>;
+
+  // The child may add any number of values to a collection, so all of them
+  // are buffered, and replayed in order.
+  static constexpr bool to_collection =
+      is_collection<typename DST_T::dst_type>::value;
+  using buffer_t = std::conditional_t<to_collection, typename DST_T::dst_type,
+                                      typename DST_T::dst_value_type>;
+  using child_dst_t = typename SelectDstWrapper<buffer_t>::type;
+
+  // The child is always buffered, and its failures must leave the data where
+  // it found it, so that cached outcomes can be replayed as-is.
+  struct child_req_t : public REQ_T {
+    enum { ATOMIC = false, FAILS_CLEANLY = true };
+  };
+
+  using child_parser_t = Parser<CTX_T, child_dst_t, child_req_t, CHILD_PAT_T>;
+
+  static constexpr bool can_memoize =
+      CTX_T::IS_CONTIGUOUS && !CTX_T::IS_RESUMABLE;
+
+  // Its address identifies this instantiation in the cache.
+  static constexpr char rule_type_ = 0;
+
+  buffer_t buffer_;
+
+  // Only created on a cache miss, since creating it may already touch the
+  // data's rollback stack.
+  std::optional<child_parser_t> parser_;
+  bool stale_ = false;
+
+ public:
+  MemoizeImpl(CTX_T, DST_T, pat_t const&) {}
+
+  void reset(CTX_T, DST_T, pat_t const&) {
+    reset_buffer(buffer_);
+    stale_ = true;
+  }
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    if constexpr (can_memoize) {
+      auto& cache = pat.cache();
+      auto remaining = ctx.data().remaining();
+      cache.set_input(ctx.data().generation());
+
+      MemoCache::Key key{remaining.data(), &rule_type_, pat.rule()};
+      if (auto entry = cache.find(key)) {
+        if (entry->result == Result::SUCCESS) {
+          ctx.data().advance(entry->length);
+          if constexpr (!std::is_same<buffer_t, Nil>::value) {
+            emit_(dst, *std::any_cast<buffer_t>(&entry->value));
+          }
+        }
+        return entry->result;
+      }
+
+      auto status = consume_child_(ctx, dst, pat);
+
+      MemoCache::Entry entry{status, 0, {}};
+      std::size_t value_size = 0;
+      if (status == Result::SUCCESS) {
+        entry.length = ctx.data().remaining().data() - remaining.data();
+        if constexpr (!std::is_same<buffer_t, Nil>::value) {
+          entry.value = buffer_;
+          value_size =
+              memo_value_size(*std::any_cast<buffer_t>(&entry.value));
+        }
+      }
+      cache.insert(key, std::move(entry), value_size);
+      return status;
+    } else {
+      return consume_child_(ctx, dst, pat);
+    }
+  }
+
+ private:
+  Result consume_child_(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    if (!parser_) {
+      parser_.emplace(ctx, child_dst_t(buffer_), pat.operand());
+    } else if (stale_) {
+      reset_parser(*parser_, ctx, child_dst_t(buffer_), pat.operand());
+    }
+    stale_ = false;
+    auto status = parser_->consume(ctx, child_dst_t(buffer_), pat.operand());
+    if (status == Result::SUCCESS) {
+      emit_(dst, buffer_);
+    }
+    return status;
+  }
+
+  static void emit_(DST_T dst, buffer_t const& values) {
+    if constexpr (to_collection) {
+      for (auto const& v : values) {
+        dst = v;
+      }
+    } else {
+      dst = values;
+    }
+  }
+};
+
+template <typename CHILD_PAT_T>
+struct ParserFactory<Memoize<CHILD_PAT_T>> {
+  using pat_t = Memoize<CHILD_PAT_T>;
+
+  static constexpr DstBehavior dst_behavior() {
+    return ParserFactory<CHILD_PAT_T>::dst_behavior();
+  }
+
+  enum {
+    ATOMIC = true,
+    FAILS_CLEANLY = true,
+  };
+
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = MemoizeImpl<CTX_T, DST_T, REQ_T, CHILD_PAT_T>;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -35,6 +35,11 @@ class NotImpl {
     ctx.data().prepare_rollback();
   }
 
+  void reset(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    reset_parser(parser_, ctx, dst, pat.operand());
+    ctx.data().prepare_rollback();
+  }
+
   Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
     auto status = parser_.consume(ctx, dst, pat.operand());
     switch (status) {
@@ -0,0 +1,183 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_COROUTINE_OPERATORS_H_
+#define ABULAFIA_PARSERS_COROUTINE_OPERATORS_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/dst_wrapper/select_wrapper.h"
+#include "abulafia/parser.h"
+#include "abulafia/patterns/unary/operators.h"
+#include "abulafia/support/assert.h"
+#include "abulafia/support/nil.h"
+#include "abulafia/support/small_stack.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Shunting-yard style precedence climbing: operands and operators are kept on
+// explicit stacks, so that suspending in the middle of an expression only
+// needs to remember the one child parser that is currently running.
+template <typename CTX_T, typename DST_T, typename REQ_T, typename PRIMARY_T,
+          typename OP_T, typename CHAR_T, typename COMBINE_T>
+class OperatorsImpl {
+  using pat_t = Operators<PRIMARY_T, OP_T, CHAR_T, COMBINE_T>;
+  using value_t = typename DST_T::dst_value_type;
+  using operand_dst_t = typename SelectDstWrapper<value_t>::type;
+  using op_dst_t = typename SelectDstWrapper<std::size_t>::type;
+
+  struct child_req_t : public DefaultReqs {
+    enum {
+      // Whatever the children leave behind on failure is discarded.
+      ATOMIC = false,
+      FAILS_CLEANLY = false,
+    };
+  };
+
+  using operand_parser_t =
+      Parser<CTX_T, operand_dst_t, child_req_t, PRIMARY_T>;
+  using op_parser_t =
+      Parser<CTX_T, op_dst_t, child_req_t, typename pat_t::op_pat_t>;
+
+  using child_parsers_t =
+      std::variant<std::monostate, operand_parser_t, op_parser_t>;
+
+  SmallStack<value_t, 8> operands_;
+  SmallStack<std::size_t, 8> ops_;
+  value_t operand_{};
+  std::size_t op_ = 0;
+
+  // Created after the rollback point is set, since creating a child parser
+  // may set rollback points of its own.
+  child_parsers_t child_parsers_;
+
+ public:
+  OperatorsImpl(CTX_T ctx, DST_T, pat_t const& pat) {
+    ctx.data().prepare_rollback();
+    child_parsers_.template emplace<1>(ctx, operand_dst_t(operand_),
+                                       pat.primary());
+  }
+
+  void reset(CTX_T ctx, DST_T, pat_t const& pat) {
+    operands_.clear();
+    ops_.clear();
+    reset_buffer(operand_);
+    op_ = 0;
+    ctx.data().prepare_rollback();
+    reset_parser_at<1>(child_parsers_, ctx, operand_dst_t(operand_),
+                       pat.primary());
+  }
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    while (1) {
+      if (child_parsers_.index() == 1) {
+        auto child_res = std::get<1>(child_parsers_)
+                             .consume(ctx, operand_dst_t(operand_),
+                                      pat.primary());
+        switch (child_res) {
+          case Result::SUCCESS:
+            ctx.data().cancel_rollback();
+            operands_.push(std::move(operand_));
+
+            ctx.data().prepare_rollback();
+            child_parsers_.template emplace<2>(ctx, op_dst_t(op_),
+                                               pat.op_pattern());
+            break;
+          case Result::FAILURE:
+            // This also gives back the operator preceding the operand.
+            ctx.data().commit_rollback();
+            if (operands_.empty()) {
+              return Result::FAILURE;
+            }
+            ops_.pop();
+            return finish_(dst, pat);
+          case Result::PARTIAL:
+            return Result::PARTIAL;
+        }
+      } else {
+        abu_assume(child_parsers_.index() == 2);
+        auto child_res = std::get<2>(child_parsers_)
+                             .consume(ctx, op_dst_t(op_), pat.op_pattern());
+        switch (child_res) {
+          case Result::SUCCESS:
+            // The rollback point stays up until the rhs operand is parsed.
+            reduce_before_(op_, pat);
+            ops_.push(op_);
+            child_parsers_.template emplace<1>(ctx, operand_dst_t(operand_),
+                                               pat.primary());
+            break;
+          case Result::FAILURE:
+            ctx.data().commit_rollback();
+            return finish_(dst, pat);
+          case Result::PARTIAL:
+            return Result::PARTIAL;
+        }
+      }
+    }
+  }
+
+ private:
+  // Applies the pending operators that bind at least as tightly as op.
+  void reduce_before_(std::size_t op, pat_t const& pat) {
+    auto const& next = pat.op_info(op);
+    while (!ops_.empty()) {
+      auto const& prev = pat.op_info(ops_.top());
+      if (prev.precedence < next.precedence ||
+          (prev.precedence == next.precedence && next.assoc == Assoc::RIGHT)) {
+        break;
+      }
+      reduce_(pat);
+    }
+  }
+
+  void reduce_(pat_t const& pat) {
+    auto const& info = pat.op_info(ops_.top());
+    ops_.pop();
+
+    value_t rhs = std::move(operands_.top());
+    operands_.pop();
+
+    if constexpr (!std::is_same<value_t, Nil>::value) {
+      value_t& lhs = operands_.top();
+      lhs = pat.combine()(info.op, std::move(lhs), std::move(rhs));
+    }
+  }
+
+  Result finish_(DST_T dst, pat_t const& pat) {
+    while (!ops_.empty()) {
+      reduce_(pat);
+    }
+    dst = std::move(operands_.top());
+    return Result::SUCCESS;
+  }
+};
+
+template <typename PRIMARY_T, typename OP_T, typename CHAR_T,
+          typename COMBINE_T>
+struct ParserFactory<Operators<PRIMARY_T, OP_T, CHAR_T, COMBINE_T>> {
+  using pat_t = Operators<PRIMARY_T, OP_T, CHAR_T, COMBINE_T>;
+
+  static constexpr DstBehavior dst_behavior() { return DstBehavior::VALUE; }
+
+  enum {
+    ATOMIC = true,
+    FAILS_CLEANLY = true,
+  };
+
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = OperatorsImpl<CTX_T, DST_T, REQ_T, PRIMARY_T, OP_T, CHAR_T,
+                             COMBINE_T>;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
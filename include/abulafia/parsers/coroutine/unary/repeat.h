@@ -11,8 +11,14 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/parsers/coroutine/leaf/character.h"
+#include "abulafia/parsers/helpers/char_run.h"
 #include "abulafia/patterns/unary/repeat.h"
 
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
 namespace ABULAFIA_NAMESPACE {
 
 template <typename CTX_T, typename DST_T, typename REQ_T, typename CHILD_PAT_T,
@@ -53,6 +59,11 @@ class RepeatImpl {
   RepeatImpl(ctx_t ctx, dst_t dst, pat_t const& pat)
       : child_parser_(ctx, child_dst_t(dst), pat.operand()) {}
 
+  void reset(ctx_t ctx, dst_t dst, pat_t const& pat) {
+    count_ = 0;
+    reset_parser(child_parser_, ctx, child_dst_t(dst), pat.operand());
+  }
+
   Result consume(ctx_t ctx, dst_t dst, pat_t const& pat) {
     while (1) {
       auto child_res =
@@ -75,7 +86,7 @@ class RepeatImpl {
           }
 
           // If we are still going, then we need to reset the child's parser
-          child_parser_ = child_parser_t(ctx, dst, pat.operand());
+          reset_parser(child_parser_, ctx, child_dst_t(dst), pat.operand());
       }
     }
   }
@@ -97,6 +108,76 @@ struct ParserFactory<Repeat<CHILD_PAT_T, MIN_REP, MAX_REP>> {
   template <typename CTX_T, typename DST_T, typename REQ_T>
   using type = RepeatImpl<CTX_T, DST_T, REQ_T, CHILD_PAT_T, MIN_REP, MAX_REP>;
 };
+
+// Repeating a single character over contiguous data does not need a child
+// parser at all: the entire run is scanned in one go.
+template <typename CTX_T, typename DST_T, typename REQ_T, typename CHARSET_T,
+          int MIN_REP, int MAX_REP>
+class CharRunImpl {
+  static_assert(!REQ_T::CONSUMES_ON_SUCCESS || MIN_REP > 0);
+
+  using pat_t = Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP>;
+
+ public:
+  CharRunImpl(CTX_T, DST_T, pat_t const&) {}
+
+  Result consume(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    auto remaining = ctx.data().remaining();
+
+    std::size_t len = remaining.size();
+    if (MAX_REP != 0 && len > std::size_t(MAX_REP)) {
+      len = MAX_REP;
+    }
+
+    std::size_t count =
+        scan_run(pat.operand().char_set(), remaining.data(), len);
+    if (count < std::size_t(MIN_REP)) {
+      return Result::FAILURE;
+    }
+
+    emit_(dst, remaining.data(), count);
+    ctx.data().advance(count);
+    return Result::SUCCESS;
+  }
+
+ private:
+  template <typename CHAR_T>
+  static void emit_(DST_T dst, CHAR_T const* data, std::size_t count) {
+    if constexpr (std::is_same<Nil, DST_T>::value) {
+      (void)dst;
+      (void)data;
+      (void)count;
+    } else if constexpr (std::is_same<typename DST_T::dst_type,
+                                      std::basic_string<CHAR_T>>::value) {
+      dst.get().append(data, count);
+    } else {
+      for (std::size_t i = 0; i < count; ++i) {
+        dst = data[i];
+      }
+    }
+  }
+};
+
+template <typename CHARSET_T, int MIN_REP, int MAX_REP>
+struct ParserFactory<Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP>> {
+  using pat_t = Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP>;
+
+  static constexpr DstBehavior dst_behavior() {
+    return ParserFactory<Char<CHARSET_T>>::dst_behavior();
+  }
+
+  enum {
+    ATOMIC = false,
+    FAILS_CLEANLY = false,
+  };
+
+  // A skipper has to run between every character, so it needs the real thing.
+  template <typename CTX_T, typename DST_T, typename REQ_T>
+  using type = std::conditional_t<
+      CTX_T::IS_CONTIGUOUS && !CTX_T::HAS_SKIPPER,
+      CharRunImpl<CTX_T, DST_T, REQ_T, CHARSET_T, MIN_REP, MAX_REP>,
+      RepeatImpl<CTX_T, DST_T, REQ_T, Char<CHARSET_T>, MIN_REP, MAX_REP>>;
+};
 }  // namespace ABULAFIA_NAMESPACE
 
 #endif
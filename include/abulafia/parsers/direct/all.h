@@ -0,0 +1,30 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_ALL_H_
+#define ABULAFIA_PARSERS_DIRECT_ALL_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/direct/direct_parser.h"
+
+#include "abulafia/parsers/direct/binary/except.h"
+#include "abulafia/parsers/direct/binary/list.h"
+#include "abulafia/parsers/direct/nary/alternative.h"
+#include "abulafia/parsers/direct/nary/sequence.h"
+#include "abulafia/parsers/direct/unary/action.h"
+#include "abulafia/parsers/direct/unary/bind_dst.h"
+#include "abulafia/parsers/direct/unary/construct.h"
+#include "abulafia/parsers/direct/unary/discard.h"
+#include "abulafia/parsers/direct/unary/lexeme.h"
+#include "abulafia/parsers/direct/unary/not.h"
+#include "abulafia/parsers/direct/unary/optional.h"
+#include "abulafia/parsers/direct/unary/repeat.h"
+#include "abulafia/parsers/direct/recur.h"
+#include "abulafia/parsers/direct/with_skipper.h"
+
+#endif
@@ -0,0 +1,49 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_EXCEPT_H_
+#define ABULAFIA_PARSERS_DIRECT_EXCEPT_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/binary/except.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/binary/except.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename OP_T, typename NEG_T>
+struct DirectParser<Except<OP_T, NEG_T>> : public DirectParserBase {
+  using pat_t = Except<OP_T, NEG_T>;
+
+  template <typename REQ_T>
+  struct op_req_t : public REQ_T {
+    enum {
+      FAILS_CLEANLY = false,
+    };
+  };
+
+  struct neg_req_t {
+    enum {
+      ATOMIC = false,
+      FAILS_CLEANLY = true,
+      CONSUMES_ON_SUCCESS = false,
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    if (parse_direct<neg_req_t>(ctx, nil, pat.neg()) == Result::SUCCESS) {
+      return Result::FAILURE;
+    }
+    return parse_direct<op_req_t<REQ_T>>(ctx, dst, pat.op());
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
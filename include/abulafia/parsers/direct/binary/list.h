@@ -0,0 +1,57 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_LIST_H_
+#define ABULAFIA_PARSERS_DIRECT_LIST_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/binary/list.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/binary/list.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename OP_T, typename SEP_T>
+struct DirectParser<List<OP_T, SEP_T>> : public DirectParserBase {
+  using pat_t = List<OP_T, SEP_T>;
+
+  struct op_req_t : public DefaultReqs {
+    enum {
+      ATOMIC = true,
+      FAILS_CLEANLY = false,
+    };
+  };
+
+  struct sep_req_t : public DefaultReqs {
+    enum {
+      ATOMIC = false,
+      FAILS_CLEANLY = false,
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    // The rollback point is always right after the last value, so that a
+    // dangling separator is given back.
+    ctx.data().prepare_rollback();
+    while (parse_direct<op_req_t>(ctx, dst, pat.op()) == Result::SUCCESS) {
+      ctx.data().cancel_rollback();
+      ctx.data().prepare_rollback();
+
+      if (parse_direct<sep_req_t>(ctx, nil, pat.sep()) != Result::SUCCESS) {
+        break;
+      }
+    }
+    ctx.data().commit_rollback();
+    return Result::SUCCESS;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,138 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_DIRECT_PARSER_H_
+#define ABULAFIA_PARSERS_DIRECT_DIRECT_PARSER_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/context.h"
+#include "abulafia/dst_wrapper/select_wrapper.h"
+#include "abulafia/parser.h"
+#include "abulafia/parsers/coroutine/recur.h"
+#include "abulafia/parsers/helpers/skip_chars.h"
+#include "abulafia/patterns/leaf/fail.h"
+#include "abulafia/result.h"
+#include "abulafia/support/nil.h"
+#include "abulafia/support/profile.h"
+
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Direct parsers are the non-resumable counterpart of the coroutine parsers:
+// each pattern is parsed by a plain function call that runs to completion,
+// so no parser state is stored anywhere.
+//
+// They follow the exact same rules as the coroutine parsers, down to the
+// ATOMIC and FAILS_CLEANLY properties advertised by ParserFactory<PAT_T>, so
+// the two can be freely mixed. Patterns that do not have a direct
+// implementation simply run their coroutine parser to completion.
+template <typename PAT_T>
+struct CoroutineDirectParser {
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, PAT_T const& pat) {
+    auto parser = make_parser_(ctx, dst, REQ_T(), pat);
+    return parser.consume(ctx, dst, pat);
+  }
+
+  enum { IS_COROUTINE = true };
+};
+
+template <typename PAT_T, typename ENABLE = void>
+struct DirectParser : public CoroutineDirectParser<PAT_T> {};
+
+// Base for the patterns that do have a direct implementation.
+struct DirectParserBase {
+  enum { IS_COROUTINE = false };
+};
+
+namespace direct_ {
+struct skip_req_t {
+  enum { ATOMIC = false, FAILS_CLEANLY = true, CONSUMES_ON_SUCCESS = true };
+};
+}  // namespace direct_
+
+// Parses pat, meeting the requirements of REQ_T. This is the direct
+// equivalent of AdaptedParserFactory.
+template <typename REQ_T, typename CTX_T, typename DST_T, typename PAT_T>
+Result parse_direct(CTX_T ctx, DST_T dst, PAT_T const& pat);
+
+namespace direct_ {
+// Does the work of the adapters around a direct parser.
+template <typename REQ_T, typename CTX_T, typename DST_T, typename PAT_T>
+Result parse_adapted(CTX_T ctx, DST_T dst, PAT_T const& pat) {
+  using direct_t = DirectParser<PAT_T>;
+  using factory_t = ParserFactory<PAT_T>;
+  constexpr bool buffered = REQ_T::ATOMIC && !factory_t::ATOMIC;
+  constexpr bool rollback = REQ_T::FAILS_CLEANLY && !factory_t::FAILS_CLEANLY;
+
+  using skip_t = typename CTX_T::skip_pattern_t;
+  if constexpr (!CTX_T::HAS_SKIPPER || skips_in_childs<PAT_T>::value) {
+    // Nothing to skip here.
+  } else if constexpr (skip_char_set<skip_t>::value) {
+    skip_chars(ctx);
+  } else {
+    using skip_ctx_t = Context<typename CTX_T::datasource_t, Fail, Nil>;
+    skip_ctx_t skip_ctx(ctx.data(), fail, nil, ctx.arena());
+    while (parse_direct<skip_req_t>(skip_ctx, nil, ctx.skipper()) ==
+           Result::SUCCESS) {
+    }
+  }
+
+  if constexpr (rollback) {
+    ctx.data().prepare_rollback();
+  }
+
+  Result status;
+  if constexpr (buffered) {
+    using buffer_t = typename DST_T::dst_value_type;
+    using buffer_dst_t = typename SelectDstWrapper<buffer_t>::type;
+
+    buffer_t buffer;
+    status = direct_t::template parse<REQ_T>(ctx, buffer_dst_t(buffer), pat);
+    if (status == Result::SUCCESS) {
+      dst = std::move(buffer);
+    }
+  } else {
+    status = direct_t::template parse<REQ_T>(ctx, dst, pat);
+  }
+
+  if constexpr (rollback) {
+    if (status == Result::SUCCESS) {
+      ctx.data().cancel_rollback();
+    } else {
+      ctx.data().commit_rollback();
+    }
+  }
+  return status;
+}
+}  // namespace direct_
+
+template <typename REQ_T, typename CTX_T, typename DST_T, typename PAT_T>
+Result parse_direct(CTX_T ctx, DST_T dst, PAT_T const& pat) {
+  static_assert(!CTX_T::IS_RESUMABLE);
+  using direct_t = DirectParser<PAT_T>;
+
+  // Coroutine parsers take care of their own requirements, and recursion
+  // does not get any, just like in RecurImpl.
+  if constexpr (direct_t::IS_COROUTINE ||
+                std::is_same<REQ_T, RecurChildReqs>::value) {
+    return direct_t::template parse<REQ_T>(ctx, dst, pat);
+  } else if constexpr (profiling_enabled) {
+    ProfileScope scope(profile_entry<PAT_T>(), profile_remaining(ctx));
+    auto status = direct_::parse_adapted<REQ_T>(ctx, dst, pat);
+    scope.finish(status, REQ_T::FAILS_CLEANLY, profile_remaining(ctx));
+    return status;
+  } else {
+    return direct_::parse_adapted<REQ_T>(ctx, dst, pat);
+  }
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
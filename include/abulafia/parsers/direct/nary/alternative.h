@@ -0,0 +1,68 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_ALTERNATIVE_H_
+#define ABULAFIA_PARSERS_DIRECT_ALTERNATIVE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/nary/alternative.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/nary/alternative.h"
+#include "abulafia/support/visit_val.h"
+
+#include <cstdint>
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename... CHILD_PATS_T>
+struct DirectParser<Alt<CHILD_PATS_T...>> : public DirectParserBase {
+  using pat_t = Alt<CHILD_PATS_T...>;
+
+  template <typename REQ_T>
+  struct child_req_t : public REQ_T {
+    enum { FAILS_CLEANLY = true };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    using value_type = decay_t<typename CTX_T::datasource_t::value_type>;
+    constexpr bool can_dispatch =
+        sizeof(value_type) == 1 && !CTX_T::HAS_SKIPPER;
+
+    if constexpr (can_dispatch) {
+      auto table = pat.dispatch_table();
+      if (table && !ctx.data().empty()) {
+        auto branch = (*table)[std::uint8_t(ctx.data().next())];
+        bool committed = (branch & pat_t::unique_branch) != 0;
+        return visit_val<sizeof...(CHILD_PATS_T)>(
+            branch & ~pat_t::unique_branch, [&](auto N) {
+              return parse_from<N(), REQ_T>(ctx, dst, pat, committed);
+            });
+      }
+    }
+    return parse_from<0, REQ_T>(ctx, dst, pat, false);
+  }
+
+  // committed is set when the child at ID is the only one that can match.
+  template <std::size_t ID, typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse_from(CTX_T ctx, DST_T dst, pat_t const& pat,
+                           bool committed) {
+    auto status = parse_direct<child_req_t<REQ_T>>(ctx, dst, getChild<ID>(pat));
+
+    if constexpr (ID + 1 < sizeof...(CHILD_PATS_T)) {
+      if (status == Result::FAILURE && !committed) {
+        return parse_from<ID + 1, REQ_T>(ctx, dst, pat, false);
+      }
+    }
+    return status;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
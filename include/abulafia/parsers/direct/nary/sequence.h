@@ -0,0 +1,53 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_SEQUENCE_H_
+#define ABULAFIA_PARSERS_DIRECT_SEQUENCE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/nary/sequence.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/nary/sequence.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename... CHILD_PATS_T>
+struct DirectParser<Seq<CHILD_PATS_T...>> : public DirectParserBase {
+  using pat_t = Seq<CHILD_PATS_T...>;
+  using childs_tuple_t = typename pat_t::child_tuple_t;
+
+  template <typename REQ_T>
+  struct child_req_t : public REQ_T {
+    enum { CONSUMES_ON_SUCCESS = false, ATOMIC = false, FAILS_CLEANLY = false };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    return parse_from<0, REQ_T>(ctx, dst, pat);
+  }
+
+  template <std::size_t ID, typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse_from(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    using accessor_t =
+        seq_::choose_dst_accessor<ID, CTX_T, DST_T, childs_tuple_t>;
+
+    auto status = parse_direct<child_req_t<REQ_T>>(
+        ctx, accessor_t::access(dst), getChild<ID>(pat));
+
+    if constexpr (ID + 1 < sizeof...(CHILD_PATS_T)) {
+      if (status == Result::SUCCESS) {
+        return parse_from<ID + 1, REQ_T>(ctx, dst, pat);
+      }
+    }
+    return status;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,32 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_RECUR_H_
+#define ABULAFIA_PARSERS_DIRECT_RECUR_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/recur.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/recur.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+// Recursion in the pattern simply becomes recursion on the call stack.
+template <typename CHILD_PAT_T, typename ATTR_T>
+struct DirectParser<Recur<CHILD_PAT_T, ATTR_T>> : public DirectParserBase {
+  using pat_t = Recur<CHILD_PAT_T, ATTR_T>;
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    return parse_direct<RecurChildReqs>(ctx, dst, pat.operand().impl);
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
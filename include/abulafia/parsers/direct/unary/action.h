@@ -0,0 +1,50 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_ACTION_H_
+#define ABULAFIA_PARSERS_DIRECT_ACTION_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/dst_wrapper/select_wrapper.h"
+#include "abulafia/parsers/coroutine/unary/action.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/action.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T, typename ACT_T>
+struct DirectParser<Action<CHILD_PAT_T, ACT_T>> : public DirectParserBase {
+  using pat_t = Action<CHILD_PAT_T, ACT_T>;
+
+  template <typename REQ_T>
+  struct child_req_t {
+    enum {
+      ATOMIC = false,
+      FAILS_CLEANLY = REQ_T::FAILS_CLEANLY,
+      CONSUMES_ON_SUCCESS = REQ_T::CONSUMES_ON_SUCCESS
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    using landing_type_t = typename act_::determine_landing_type<
+        ACT_T, typename CTX_T::bound_dst_t>::type;
+
+    landing_type_t landing;
+    auto status = parse_direct<child_req_t<REQ_T>>(ctx, wrap_dst(landing),
+                                                   pat.child_pattern());
+    if (status == Result::SUCCESS) {
+      act_::act_dispatch(pat.action(), std::move(landing), dst, ctx);
+    }
+    return status;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,42 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_BIND_DST_H_
+#define ABULAFIA_PARSERS_DIRECT_BIND_DST_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/unary/bind_dst.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/bind_dst.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T>
+struct DirectParser<BindDst<CHILD_PAT_T>> : public DirectParserBase {
+  using pat_t = BindDst<CHILD_PAT_T>;
+
+  template <typename REQ_T>
+  struct child_req_t : public REQ_T {
+    enum {
+      ATOMIC = false,
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    using sub_ctx_t = typename CTX_T::template bind_dst<DST_T>;
+
+    return parse_direct<child_req_t<REQ_T>>(
+        sub_ctx_t(ctx.data(), ctx.skipper(), dst, ctx.arena()), dst,
+        pat.operand());
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
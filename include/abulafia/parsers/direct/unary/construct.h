@@ -0,0 +1,48 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_CONSTRUCT_H_
+#define ABULAFIA_PARSERS_DIRECT_CONSTRUCT_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/dst_wrapper/select_wrapper.h"
+#include "abulafia/parsers/coroutine/unary/construct.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/construct.h"
+
+#include <tuple>
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T, typename... ARGS_T>
+struct DirectParser<Construct<CHILD_PAT_T, ARGS_T...>>
+    : public DirectParserBase {
+  using pat_t = Construct<CHILD_PAT_T, ARGS_T...>;
+  using buffer_t = std::tuple<ARGS_T...>;
+  using child_dst_t = typename SelectDstWrapper<buffer_t>::type;
+
+  template <typename REQ_T>
+  struct child_req_t : public REQ_T {
+    enum { ATOMIC = false };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    buffer_t buffer;
+    auto status = parse_direct<child_req_t<REQ_T>>(ctx, child_dst_t(buffer),
+                                                   pat.child_pattern());
+    if (status == Result::SUCCESS) {
+      dst = std::make_from_tuple<typename DST_T::dst_type>(buffer);
+    }
+    return status;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
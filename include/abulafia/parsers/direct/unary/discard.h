@@ -0,0 +1,31 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_DISCARD_H_
+#define ABULAFIA_PARSERS_DIRECT_DISCARD_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/unary/discard.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/discard.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T>
+struct DirectParser<Discard<CHILD_PAT_T>> : public DirectParserBase {
+  using pat_t = Discard<CHILD_PAT_T>;
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T, pat_t const& pat) {
+    return parse_direct<REQ_T>(ctx, nil, pat.operand());
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,35 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_LEXEME_H_
+#define ABULAFIA_PARSERS_DIRECT_LEXEME_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/unary/lexeme.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/lexeme.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T>
+struct DirectParser<Lexeme<CHILD_PAT_T>> : public DirectParserBase {
+  using pat_t = Lexeme<CHILD_PAT_T>;
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    using sub_ctx_t = typename CTX_T::template set_skipper_t<Fail>;
+
+    return parse_direct<REQ_T>(
+        sub_ctx_t(ctx.data(), fail, ctx.bound_dst(), ctx.arena()), dst,
+        pat.operand());
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,43 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_NOT_H_
+#define ABULAFIA_PARSERS_DIRECT_NOT_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/unary/not.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/not.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T>
+struct DirectParser<Not<CHILD_PAT_T>> : public DirectParserBase {
+  using pat_t = Not<CHILD_PAT_T>;
+
+  template <typename REQ_T>
+  struct child_req_t : public REQ_T {
+    enum {
+      ATOMIC = false,
+      FAILS_CLEANLY = false,
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    ctx.data().prepare_rollback();
+    auto status = parse_direct<child_req_t<REQ_T>>(ctx, dst, pat.operand());
+    ctx.data().commit_rollback();
+
+    return status == Result::SUCCESS ? Result::FAILURE : Result::SUCCESS;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,47 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_OPTIONAL_H_
+#define ABULAFIA_PARSERS_DIRECT_OPTIONAL_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/unary/optional.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/optional.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T>
+struct DirectParser<Optional<CHILD_PAT_T>> : public DirectParserBase {
+  using pat_t = Optional<CHILD_PAT_T>;
+
+  template <typename REQ_T>
+  struct child_req_t {
+    enum {
+      ATOMIC = true,
+      FAILS_CLEANLY = false,
+      CONSUMES_ON_SUCCESS = REQ_T::CONSUMES_ON_SUCCESS
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    ctx.data().prepare_rollback();
+    if (parse_direct<child_req_t<REQ_T>>(ctx, dst, pat.operand()) ==
+        Result::SUCCESS) {
+      ctx.data().cancel_rollback();
+    } else {
+      ctx.data().commit_rollback();
+    }
+    return Result::SUCCESS;
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,61 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_REPEAT_H_
+#define ABULAFIA_PARSERS_DIRECT_REPEAT_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/unary/repeat.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/unary/repeat.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T, int MIN_REP, int MAX_REP>
+struct DirectParser<Repeat<CHILD_PAT_T, MIN_REP, MAX_REP>>
+    : public DirectParserBase {
+  using pat_t = Repeat<CHILD_PAT_T, MIN_REP, MAX_REP>;
+
+  template <typename REQ_T>
+  struct child_req_t {
+    enum {
+      ATOMIC = true,
+      FAILS_CLEANLY = MIN_REP != MAX_REP || MAX_REP == 0,
+      CONSUMES_ON_SUCCESS = REQ_T::CONSUMES_ON_SUCCESS
+    };
+  };
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    static_assert(!REQ_T::CONSUMES_ON_SUCCESS || MIN_REP > 0);
+
+    int count = 0;
+    while (1) {
+      auto status =
+          parse_direct<child_req_t<REQ_T>>(ctx, dst, pat.operand());
+      if (status != Result::SUCCESS) {
+        return count >= MIN_REP ? Result::SUCCESS : status;
+      }
+
+      ++count;
+      if (MAX_REP != 0 && count == MAX_REP) {
+        return Result::SUCCESS;
+      }
+    }
+  }
+};
+
+// Character runs are already handled in one go by CharRunImpl.
+template <typename CHARSET_T, int MIN_REP, int MAX_REP>
+struct DirectParser<Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP>>
+    : public CoroutineDirectParser<
+          Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP>> {};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,36 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSERS_DIRECT_WITH_SKIPPER_H_
+#define ABULAFIA_PARSERS_DIRECT_WITH_SKIPPER_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/coroutine/with_skipper.h"
+#include "abulafia/parsers/direct/direct_parser.h"
+#include "abulafia/patterns/with_skipper.h"
+
+namespace ABULAFIA_NAMESPACE {
+
+template <typename CHILD_PAT_T, typename SKIP_T>
+struct DirectParser<WithSkipper<CHILD_PAT_T, SKIP_T>>
+    : public DirectParserBase {
+  using pat_t = WithSkipper<CHILD_PAT_T, SKIP_T>;
+
+  template <typename REQ_T, typename CTX_T, typename DST_T>
+  static Result parse(CTX_T ctx, DST_T dst, pat_t const& pat) {
+    using sub_ctx_t = typename CTX_T::template set_skipper_t<SKIP_T>;
+
+    return parse_direct<REQ_T>(
+        sub_ctx_t(ctx.data(), pat.getSkip(), ctx.bound_dst(), ctx.arena()),
+        dst, pat.getChild());
+  }
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,144 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSER_HELPERS_CHAR_RUN_H_
+#define ABULAFIA_PARSER_HELPERS_CHAR_RUN_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/char_set/compiled.h"
+#include "abulafia/support/type_traits.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+namespace ABULAFIA_NAMESPACE {
+
+namespace char_run_ {
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+inline int count_trailing_zeros(std::uint32_t v) {
+#if defined(_MSC_VER)
+  unsigned long r;
+  _BitScanForward(&r, v);
+  return int(r);
+#else
+  return __builtin_ctz(v);
+#endif
+}
+#endif
+
+#if defined(__SSSE3__)
+// Returns a mask of the bytes in v that do NOT belong to the set.
+inline std::uint32_t non_members_16(__m128i v, __m128i bitmaps_lo,
+                                    __m128i bitmaps_hi, __m128i bits) {
+  __m128i nibble_mask = _mm_set1_epi8(0x0F);
+  __m128i lo = _mm_and_si128(v, nibble_mask);
+  __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask);
+
+  __m128i row_lo = _mm_shuffle_epi8(bitmaps_lo, lo);
+  __m128i row_hi = _mm_shuffle_epi8(bitmaps_hi, lo);
+  __m128i use_hi = _mm_cmpgt_epi8(hi, _mm_set1_epi8(7));
+  __m128i row = _mm_or_si128(_mm_and_si128(use_hi, row_hi),
+                             _mm_andnot_si128(use_hi, row_lo));
+
+  __m128i bit = _mm_shuffle_epi8(bits, hi);
+  __m128i miss = _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+  return std::uint32_t(_mm_movemask_epi8(miss));
+}
+#endif
+
+#if defined(__AVX2__)
+inline std::uint32_t non_members_32(__m256i v, __m256i bitmaps_lo,
+                                    __m256i bitmaps_hi, __m256i bits) {
+  __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+  __m256i lo = _mm256_and_si256(v, nibble_mask);
+  __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+
+  __m256i row_lo = _mm256_shuffle_epi8(bitmaps_lo, lo);
+  __m256i row_hi = _mm256_shuffle_epi8(bitmaps_hi, lo);
+  __m256i use_hi = _mm256_cmpgt_epi8(hi, _mm256_set1_epi8(7));
+  __m256i row = _mm256_blendv_epi8(row_lo, row_hi, use_hi);
+
+  __m256i bit = _mm256_shuffle_epi8(bits, hi);
+  __m256i miss =
+      _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), _mm256_setzero_si256());
+  return std::uint32_t(_mm256_movemask_epi8(miss));
+}
+#endif
+
+}  // namespace char_run_
+
+// Returns the length of the longest prefix of [data, data + len) made only of
+// characters belonging to the set.
+template <typename CHARSET_T, typename CHAR_T>
+std::size_t scan_run(CHARSET_T const& chars, CHAR_T const* data,
+                     std::size_t len) {
+  std::size_t i = 0;
+  while (i < len && chars.is_valid(data[i])) {
+    ++i;
+  }
+  return i;
+}
+
+// Compiled sets over bytes are classified 16 or 32 bytes at a time when the
+// target supports it.
+template <typename CHAR_T>
+std::size_t scan_run(char_set::Compiled<CHAR_T> const& chars,
+                     CHAR_T const* data, std::size_t len) {
+  std::size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+  auto const& bitmaps = chars.nibble_bitmaps();
+  __m128i bitmaps_lo = _mm_loadu_si128(
+      reinterpret_cast<__m128i const*>(bitmaps.data()));
+  __m128i bitmaps_hi = _mm_loadu_si128(
+      reinterpret_cast<__m128i const*>(bitmaps.data() + 16));
+  __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16,
+                               32, 64, -128);
+#endif
+
+#if defined(__AVX2__)
+  __m256i bitmaps_lo_32 = _mm256_broadcastsi128_si256(bitmaps_lo);
+  __m256i bitmaps_hi_32 = _mm256_broadcastsi128_si256(bitmaps_hi);
+  __m256i bits_32 = _mm256_broadcastsi128_si256(bits);
+
+  for (; i + 32 <= len; i += 32) {
+    __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + i));
+    std::uint32_t miss =
+        char_run_::non_members_32(v, bitmaps_lo_32, bitmaps_hi_32, bits_32);
+    if (miss) {
+      return i + char_run_::count_trailing_zeros(miss);
+    }
+  }
+#endif
+
+#if defined(__SSSE3__)
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i));
+    std::uint32_t miss =
+        char_run_::non_members_16(v, bitmaps_lo, bitmaps_hi, bits);
+    if (miss) {
+      return i + char_run_::count_trailing_zeros(miss);
+    }
+  }
+#endif
+
+  while (i < len && chars.is_valid(data[i])) {
+    ++i;
+  }
+  return i;
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
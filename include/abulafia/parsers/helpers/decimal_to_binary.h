@@ -0,0 +1,511 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSER_HELPERS_DECIMAL_TO_BINARY_H_
+#define ABULAFIA_PARSER_HELPERS_DECIMAL_TO_BINARY_H_
+
+#include "abulafia/config.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Conversion of w * 10^q into the nearest binary floating point value.
+//
+// Exact cases go through Clinger's fast path, everything else uses the
+// Eisel-Lemire algorithm, which only needs a 128-bit approximation of 5^q.
+// See: Daniel Lemire, "Number Parsing at a Gigabyte per Second" and
+// Noble Mushtak, Daniel Lemire, "Fast Number Parsing Without Fallback".
+namespace decimal_to_binary_ {
+
+template <typename T>
+struct BinaryFormat;
+
+template <>
+struct BinaryFormat<double> {
+  using bits_t = std::uint64_t;
+  static constexpr int mantissa_explicit_bits = 52;
+  static constexpr int minimum_exponent = -1023;
+  static constexpr int infinite_power = 0x7FF;
+  static constexpr int sign_index = 63;
+  static constexpr int min_exponent_fast_path = -22;
+  static constexpr int max_exponent_fast_path = 22;
+  static constexpr std::uint64_t max_mantissa_fast_path = std::uint64_t(2)
+                                                          << 52;
+  static constexpr int min_exponent_round_to_even = -4;
+  static constexpr int max_exponent_round_to_even = 23;
+  static constexpr int smallest_power_of_ten = -342;
+  static constexpr int largest_power_of_ten = 308;
+
+  static double exact_power_of_ten(int e) {
+    static constexpr double powers[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    return powers[e];
+  }
+};
+
+template <>
+struct BinaryFormat<float> {
+  using bits_t = std::uint32_t;
+  static constexpr int mantissa_explicit_bits = 23;
+  static constexpr int minimum_exponent = -127;
+  static constexpr int infinite_power = 0xFF;
+  static constexpr int sign_index = 31;
+  static constexpr int min_exponent_fast_path = -10;
+  static constexpr int max_exponent_fast_path = 10;
+  static constexpr std::uint64_t max_mantissa_fast_path = std::uint64_t(2)
+                                                          << 23;
+  static constexpr int min_exponent_round_to_even = -17;
+  static constexpr int max_exponent_round_to_even = 10;
+  static constexpr int smallest_power_of_ten = -65;
+  static constexpr int largest_power_of_ten = 38;
+
+  static float exact_power_of_ten(int e) {
+    static constexpr float powers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                       1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    return powers[e];
+  }
+};
+
+constexpr int smallest_power_of_five = -342;
+constexpr int largest_power_of_five = 308;
+constexpr std::size_t power_count =
+    largest_power_of_five - smallest_power_of_five + 1;
+
+struct Value128 {
+  std::uint64_t low;
+  std::uint64_t high;
+};
+
+inline Value128 full_multiplication(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128_t = unsigned __int128;
+  uint128_t r = uint128_t(a) * b;
+  return {std::uint64_t(r), std::uint64_t(r >> 64)};
+#else
+  std::uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+  std::uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+
+  std::uint64_t lo_lo = a_lo * b_lo;
+  std::uint64_t hi_lo = a_hi * b_lo;
+  std::uint64_t lo_hi = a_lo * b_hi;
+  std::uint64_t hi_hi = a_hi * b_hi;
+
+  std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+  return {(cross << 32) | (lo_lo & 0xFFFFFFFF),
+          (hi_lo >> 32) + (cross >> 32) + hi_hi};
+#endif
+}
+
+inline int leading_zeroes(std::uint64_t v) {
+#if defined(__GNUC__)
+  return __builtin_clzll(v);
+#else
+  int r = 0;
+  while (!(v & (std::uint64_t(1) << 63))) {
+    v <<= 1;
+    ++r;
+  }
+  return r;
+#endif
+}
+
+// Minimal arbitrary precision unsigned integer, used to build the table of
+// powers of five, and to settle the cases that 19 digits cannot.
+class BigUInt {
+ public:
+  explicit BigUInt(std::uint32_t v) : limbs_{v} {}
+
+  static BigUInt power_of_two(int e) {
+    BigUInt r(0);
+    r.limbs_.assign(std::size_t(e / 32 + 1), 0);
+    r.limbs_.back() = std::uint32_t(1) << (e % 32);
+    return r;
+  }
+
+  void mul(std::uint32_t v) {
+    std::uint64_t carry = 0;
+    for (auto& l : limbs_) {
+      std::uint64_t p = std::uint64_t(l) * v + carry;
+      l = std::uint32_t(p);
+      carry = p >> 32;
+    }
+    if (carry) {
+      limbs_.push_back(std::uint32_t(carry));
+    }
+  }
+
+  // Floor division.
+  void div(std::uint32_t v) {
+    std::uint64_t rem = 0;
+    for (auto i = limbs_.size(); i-- > 0;) {
+      std::uint64_t cur = (rem << 32) | limbs_[i];
+      limbs_[i] = std::uint32_t(cur / v);
+      rem = cur % v;
+    }
+    trim_();
+  }
+
+  void add_one() { add(1); }
+
+  void add(std::uint32_t v) {
+    std::uint64_t carry = v;
+    for (auto& l : limbs_) {
+      if (carry == 0) {
+        return;
+      }
+      std::uint64_t sum = std::uint64_t(l) + carry;
+      l = std::uint32_t(sum);
+      carry = sum >> 32;
+    }
+    if (carry) {
+      limbs_.push_back(std::uint32_t(carry));
+    }
+  }
+
+  void mul_pow5(std::int64_t e) {
+    for (; e >= 13; e -= 13) {
+      mul(1220703125);  // 5^13
+    }
+    for (; e > 0; --e) {
+      mul(5);
+    }
+  }
+
+  void shift_left(std::int64_t e) {
+    auto limbs = std::size_t(e / 32);
+    int bits = int(e % 32);
+    if (bits != 0) {
+      std::uint32_t carry = 0;
+      for (auto& l : limbs_) {
+        std::uint32_t next = l >> (32 - bits);
+        l = (l << bits) | carry;
+        carry = next;
+      }
+      if (carry) {
+        limbs_.push_back(carry);
+      }
+    }
+    limbs_.insert(limbs_.begin(), limbs, 0);
+    trim_();
+  }
+
+  // -1, 0 or 1, as lhs is less than, equal to or greater than rhs.
+  friend int compare(BigUInt const& lhs, BigUInt const& rhs) {
+    if (lhs.limbs_.size() != rhs.limbs_.size()) {
+      return lhs.limbs_.size() < rhs.limbs_.size() ? -1 : 1;
+    }
+    for (auto i = lhs.limbs_.size(); i-- > 0;) {
+      if (lhs.limbs_[i] != rhs.limbs_[i]) {
+        return lhs.limbs_[i] < rhs.limbs_[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  int bit_length() const {
+    int r = int(limbs_.size() - 1) * 32;
+    for (std::uint32_t top = limbs_.back(); top; top >>= 1) {
+      ++r;
+    }
+    return r;
+  }
+
+  // floor(*this / 2^shift) when shift >= 0, *this * 2^-shift otherwise,
+  // which must fit in 128 bits.
+  Value128 shifted_128(int shift) const {
+    Value128 r{0, 0};
+    for (int b = 127; b >= 0; --b) {
+      int src = b + shift;
+      if (src >= 0 && bit_(src)) {
+        (b >= 64 ? r.high : r.low) |= std::uint64_t(1) << (b % 64);
+      }
+    }
+    return r;
+  }
+
+ private:
+  bool bit_(int i) const {
+    auto limb = std::size_t(i / 32);
+    return limb < limbs_.size() && ((limbs_[limb] >> (i % 32)) & 1);
+  }
+
+  void trim_() {
+    while (limbs_.size() > 1 && limbs_.back() == 0) {
+      limbs_.pop_back();
+    }
+  }
+
+  std::vector<std::uint32_t> limbs_;
+};
+
+// 5^q, normalized so that its most significant bit is bit 127. Powers below
+// 5^0 are rounded up. Each entry is stored as {high, low}.
+inline std::array<std::uint64_t, 2 * power_count> const& powers_of_five() {
+  static const auto table = [] {
+    std::array<std::uint64_t, 2 * power_count> result{};
+    auto store = [&](int q, Value128 v) {
+      auto index = std::size_t(2 * (q - smallest_power_of_five));
+      result[index] = v.high;
+      result[index + 1] = v.low;
+    };
+
+    BigUInt p(1);
+    for (int q = 0; q <= largest_power_of_five; ++q) {
+      store(q, p.shifted_128(p.bit_length() - 128));
+      p.mul(5);
+    }
+
+    BigUInt five(1);
+    for (int q = -1; q >= smallest_power_of_five; --q) {
+      five.mul(5);
+      // z is the smallest value such that 5^-q < 2^z.
+      int z = five.bit_length();
+
+      BigUInt v = BigUInt::power_of_two(q >= -27 ? z + 127 : 2 * z + 128);
+      // floor(floor(a / b) / c) == floor(a / (b * c))
+      int remaining = -q;
+      for (; remaining >= 13; remaining -= 13) {
+        v.div(1220703125);  // 5^13
+      }
+      for (; remaining > 0; --remaining) {
+        v.div(5);
+      }
+      v.add_one();
+      int excess = v.bit_length() - 128;
+      store(q, v.shifted_128(excess > 0 ? excess : 0));
+    }
+    return result;
+  }();
+  return table;
+}
+
+struct AdjustedMantissa {
+  std::uint64_t mantissa = 0;
+  int power2 = 0;
+};
+
+template <int BIT_PRECISION>
+Value128 compute_product_approximation(std::int64_t q, std::uint64_t w) {
+  auto const& powers = powers_of_five();
+  auto index = std::size_t(2 * (q - smallest_power_of_five));
+
+  Value128 first = full_multiplication(w, powers[index]);
+  constexpr std::uint64_t precision_mask =
+      BIT_PRECISION < 64 ? (~std::uint64_t(0) >> BIT_PRECISION)
+                         : ~std::uint64_t(0);
+  if ((first.high & precision_mask) == precision_mask) {
+    Value128 second = full_multiplication(w, powers[index + 1]);
+    first.low += second.high;
+    if (second.high > first.low) {
+      first.high++;
+    }
+  }
+  return first;
+}
+
+// floor(log2(10^q)) + 63
+inline int power(int q) { return (((152170 + 65536) * q) >> 16) + 63; }
+
+template <typename FMT>
+AdjustedMantissa compute_float(std::int64_t q, std::uint64_t w) {
+  AdjustedMantissa answer;
+  if (w == 0 || q < FMT::smallest_power_of_ten) {
+    return answer;
+  }
+  if (q > FMT::largest_power_of_ten) {
+    answer.power2 = FMT::infinite_power;
+    return answer;
+  }
+
+  int lz = leading_zeroes(w);
+  w <<= lz;
+
+  Value128 product =
+      compute_product_approximation<FMT::mantissa_explicit_bits + 3>(q, w);
+
+  int upperbit = int(product.high >> 63);
+  int shift = upperbit + 64 - FMT::mantissa_explicit_bits - 3;
+
+  answer.mantissa = product.high >> shift;
+  answer.power2 =
+      power(int(q)) + upperbit - lz - FMT::minimum_exponent;
+
+  if (answer.power2 <= 0) {
+    // Subnormal.
+    if (-answer.power2 + 1 >= 64) {
+      answer.power2 = 0;
+      answer.mantissa = 0;
+      return answer;
+    }
+    answer.mantissa >>= -answer.power2 + 1;
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+    answer.power2 =
+        answer.mantissa < (std::uint64_t(1) << FMT::mantissa_explicit_bits)
+            ? 0
+            : 1;
+    return answer;
+  }
+
+  // Exactly halfway between two values: round to even.
+  if (product.low <= 1 && q >= FMT::min_exponent_round_to_even &&
+      q <= FMT::max_exponent_round_to_even && (answer.mantissa & 3) == 1) {
+    if ((answer.mantissa << shift) == product.high) {
+      answer.mantissa &= ~std::uint64_t(1);
+    }
+  }
+
+  answer.mantissa += (answer.mantissa & 1);
+  answer.mantissa >>= 1;
+  if (answer.mantissa >= (std::uint64_t(2) << FMT::mantissa_explicit_bits)) {
+    answer.mantissa = std::uint64_t(1) << FMT::mantissa_explicit_bits;
+    answer.power2++;
+  }
+
+  answer.mantissa &= ~(std::uint64_t(1) << FMT::mantissa_explicit_bits);
+  if (answer.power2 >= FMT::infinite_power) {
+    answer.power2 = FMT::infinite_power;
+    answer.mantissa = 0;
+  }
+  return answer;
+}
+
+// Compares digits * 10^exponent against the value halfway between am and the
+// next representable value up.
+template <typename FMT>
+int compare_to_halfway(std::string const& digits, std::int64_t exponent,
+                       AdjustedMantissa am) {
+  std::uint64_t mantissa = am.mantissa;
+  std::int64_t power2 = am.power2;
+  if (am.power2 == 0) {
+    power2 = 1;
+  } else {
+    mantissa |= std::uint64_t(1) << FMT::mantissa_explicit_bits;
+  }
+  power2 += FMT::minimum_exponent - FMT::mantissa_explicit_bits;
+
+  // halfway = (2 * mantissa + 1) * 2^(power2 - 1)
+  std::uint64_t twice_plus_one = 2 * mantissa + 1;
+  BigUInt halfway(std::uint32_t(twice_plus_one >> 32));
+  halfway.shift_left(32);
+  halfway.add(std::uint32_t(twice_plus_one));
+  power2 -= 1;
+
+  BigUInt value(0);
+  for (std::size_t i = 0; i < digits.size(); i += 9) {
+    std::uint32_t chunk = 0;
+    std::uint32_t scale = 1;
+    for (std::size_t j = i; j < digits.size() && j < i + 9; ++j) {
+      chunk = chunk * 10 + std::uint32_t(digits[j] - '0');
+      scale *= 10;
+    }
+    value.mul(scale);
+    value.add(chunk);
+  }
+
+  // Both sides are brought to integers: 10^e = 5^e * 2^e.
+  if (exponent >= 0) {
+    value.mul_pow5(exponent);
+  } else {
+    halfway.mul_pow5(-exponent);
+  }
+  std::int64_t shift = exponent - power2;
+  if (shift >= 0) {
+    value.shift_left(shift);
+  } else {
+    halfway.shift_left(-shift);
+  }
+  return compare(value, halfway);
+}
+
+template <typename T>
+T to_float(AdjustedMantissa am, bool negative) {
+  using fmt = BinaryFormat<T>;
+  using bits_t = typename fmt::bits_t;
+
+  bits_t bits = bits_t(am.mantissa) |
+                (bits_t(am.power2) << fmt::mantissa_explicit_bits) |
+                (bits_t(negative) << fmt::sign_index);
+  T result;
+  std::memcpy(&result, &bits, sizeof(T));
+  return result;
+}
+
+}  // namespace decimal_to_binary_
+
+// Decimal floating point value, as accumulated by a parser.
+//  value = (negative ? -1 : 1) * mantissa * 10^exponent
+// If more than 19 significant digits were read, mantissa only holds the
+// first 19 of them, and truncated is set if any non-zero digit was dropped.
+// In that case, all significant digits must be available in digits, as an
+// integer scaled by 10^(exponent - dropped_digits).
+struct DecimalFloat {
+  std::uint64_t mantissa = 0;
+  std::int64_t exponent = 0;
+  bool negative = false;
+  bool truncated = false;
+  std::string digits;
+  std::int64_t dropped_digits = 0;
+};
+
+// Returns the floating point value closest to d.
+template <typename T>
+T decimal_to_binary(DecimalFloat const& d) {
+  using namespace decimal_to_binary_;
+  using fmt = BinaryFormat<T>;
+
+  static_assert(std::numeric_limits<T>::is_iec559 &&
+                    std::numeric_limits<T>::radix == 2,
+                "Only IEEE 754 float and double are supported");
+
+  if (!d.truncated) {
+    // Clinger's fast path: both w and 10^q are exact, so a single rounding
+    // happens.
+    if (d.exponent >= fmt::min_exponent_fast_path &&
+        d.exponent <= fmt::max_exponent_fast_path &&
+        d.mantissa <= fmt::max_mantissa_fast_path) {
+      T value = T(d.mantissa);
+      if (d.exponent < 0) {
+        value = value / fmt::exact_power_of_ten(int(-d.exponent));
+      } else {
+        value = value * fmt::exact_power_of_ten(int(d.exponent));
+      }
+      return d.negative ? -value : value;
+    }
+
+    return to_float<T>(compute_float<fmt>(d.exponent, d.mantissa),
+                       d.negative);
+  }
+
+  // If rounding both the truncated mantissa and the next value up lands on
+  // the same result, the dropped digits cannot matter.
+  auto lower = compute_float<fmt>(d.exponent, d.mantissa);
+  auto upper = compute_float<fmt>(d.exponent, d.mantissa + 1);
+  if (lower.mantissa == upper.mantissa && lower.power2 == upper.power2) {
+    return to_float<T>(lower, d.negative);
+  }
+
+  // The value lies strictly between the two, which are adjacent, so it rounds
+  // to one or the other. The full digit string tells which side of the
+  // halfway point it is on.
+  int cmp = compare_to_halfway<fmt>(d.digits, d.exponent - d.dropped_digits,
+                                    lower);
+  bool round_up = cmp > 0 || (cmp == 0 && (lower.mantissa & 1) != 0);
+  return to_float<T>(round_up ? upper : lower, d.negative);
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,183 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSER_HELPERS_PARSE_DIGITS_H_
+#define ABULAFIA_PARSER_HELPERS_PARSE_DIGITS_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/helpers/digit_values.h"
+#include "abulafia/support/type_traits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Appends a group of digits worth `chunk`, read from a group worth `mult`, to
+// the value v. Negative values are accumulated downwards so that the minimum
+// value of signed types can be reached.
+// Returns false if the result does not fit in T.
+template <typename T>
+bool append_digits(T& v, std::uint64_t mult, std::uint32_t chunk, bool neg) {
+  if constexpr (std::is_integral<T>::value) {
+    using lim = std::numeric_limits<T>;
+    T m = T(mult);
+    T c = T(chunk);
+    if (neg) {
+      if (v < (lim::min() + c) / m) {
+        return false;
+      }
+      v = v * m - c;
+    } else {
+      if (v > (lim::max() - c) / m) {
+        return false;
+      }
+      v = v * m + c;
+    }
+  } else {
+    // Nil and floating point values.
+    v *= T(mult);
+    if (neg) {
+      v -= T(chunk);
+    } else {
+      v += T(chunk);
+    }
+  }
+  return true;
+}
+
+namespace swar_ {
+
+constexpr std::uint64_t repeat_byte(std::uint8_t b) {
+  return 0x0101010101010101ULL * b;
+}
+
+// Sets the high bit of every byte of x (all < 0x80) that is within [lo, hi].
+constexpr std::uint64_t bytes_in_range(std::uint64_t x, std::uint8_t lo,
+                                       std::uint8_t hi) {
+  return ((x + repeat_byte(0x80 - lo)) & ~(x + repeat_byte(0x7F - hi))) &
+         repeat_byte(0x80);
+}
+
+inline std::uint64_t load_8(char const* p) {
+  std::uint64_t v;
+  std::memcpy(&v, p, 8);
+  return v;
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool enabled = false;
+#else
+constexpr bool enabled = true;
+#endif
+
+// Converts 8 decimal digits at once. Returns false if any of them is not a
+// digit.
+inline bool parse_8_dec(char const* p, std::uint32_t& out) {
+  std::uint64_t v = load_8(p);
+  if (v & repeat_byte(0x80)) {
+    return false;
+  }
+  if (bytes_in_range(v, '0', '9') != repeat_byte(0x80)) {
+    return false;
+  }
+
+  v -= repeat_byte('0');
+  v = (v * 10) + (v >> 8);
+  v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+       (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+      32;
+  out = std::uint32_t(v);
+  return true;
+}
+
+// Converts 8 hexadecimal digits at once. Returns false if any of them is not
+// a hex digit.
+inline bool parse_8_hex(char const* p, std::uint32_t& out) {
+  std::uint64_t v = load_8(p);
+  if (v & repeat_byte(0x80)) {
+    return false;
+  }
+
+  std::uint64_t lower = v | repeat_byte(0x20);
+  std::uint64_t digits = bytes_in_range(v, '0', '9');
+  std::uint64_t alphas = bytes_in_range(lower, 'a', 'f');
+  if ((digits | alphas) != repeat_byte(0x80)) {
+    return false;
+  }
+
+  // Nibble value of every byte, first character in the lowest byte.
+  std::uint64_t n = (v & repeat_byte(0x0F)) + (alphas >> 7) * 9;
+
+  // Pair up nibbles, then bytes, then 16-bit words, most significant first.
+  n = ((n & repeat_byte(0x0F)) << 4 | (n >> 8)) & 0x00FF00FF00FF00FFULL;
+  n = ((n & 0x0000FFFF0000FFFFULL) << 8 | (n >> 16)) & 0x0000FFFF0000FFFFULL;
+  n = (n & 0xFFFFULL) << 16 | (n >> 32);
+  out = std::uint32_t(n);
+  return true;
+}
+
+template <int BASE>
+constexpr std::uint64_t chunk_mult() {
+  return BASE == 10 ? 100000000ULL : 0x100000000ULL;
+}
+
+}  // namespace swar_
+
+// Parses as many digits as possible (up to max_count) from the start of data
+// into v. Returns false on overflow, the number of digits read is always
+// written to count.
+template <int BASE, typename CHAR_T, typename T>
+bool parse_digits(std::basic_string_view<CHAR_T> data, std::size_t max_count,
+                  T& v, bool neg, std::size_t& count) {
+  using digit_vals = DigitValues<BASE>;
+
+  std::size_t len = data.size() < max_count ? data.size() : max_count;
+  std::size_t i = 0;
+
+  // Groups of 8 digits are converted at once, as long as a group of digits
+  // is guaranteed to fit in T.
+  constexpr bool value_fits_chunk =
+      !std::is_integral<T>::value ||
+      std::numeric_limits<T>::digits > (BASE == 10 ? 27 : 32);
+  if constexpr (swar_::enabled && (BASE == 10 || BASE == 16) &&
+                sizeof(CHAR_T) == 1 && value_fits_chunk) {
+    auto ptr = reinterpret_cast<char const*>(data.data());
+    std::uint32_t chunk;
+    while (i + 8 <= len) {
+      bool ok = BASE == 10 ? swar_::parse_8_dec(ptr + i, chunk)
+                           : swar_::parse_8_hex(ptr + i, chunk);
+      if (!ok) {
+        break;
+      }
+      if (!append_digits(v, swar_::chunk_mult<BASE>(), chunk, neg)) {
+        count = i;
+        return false;
+      }
+      i += 8;
+    }
+  }
+
+  for (; i < len && digit_vals::is_valid(data[i]); ++i) {
+    if (!append_digits(v, BASE, digit_vals::value(data[i]), neg)) {
+      count = i;
+      return false;
+    }
+  }
+
+  count = i;
+  return true;
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
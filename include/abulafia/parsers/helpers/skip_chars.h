@@ -0,0 +1,100 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PARSER_HELPERS_SKIP_CHARS_H_
+#define ABULAFIA_PARSER_HELPERS_SKIP_CHARS_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parsers/helpers/char_run.h"
+#include "abulafia/result.h"
+
+#include <tuple>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+// This is needed by the parser factories, which the pattern headers depend on.
+template <typename CHARSET_T>
+class Char;
+template <typename PAT_T>
+class Discard;
+template <typename PAT_T, int MIN_REP, int MAX_REP>
+class Repeat;
+template <typename... CHILD_PATS_T>
+class Alt;
+
+// Skippers that match nothing but characters from a set, such as lit(' '),
+// char_(" \t\n") or *char_(" \t\n"), don't need a parser: running them until
+// they fail amounts to scanning past every character of the set.
+template <typename PAT_T>
+struct skip_char_set : public std::false_type {};
+
+template <typename CHARSET_T>
+struct skip_char_set<Char<CHARSET_T>> : public std::true_type {
+  static auto const& get(Char<CHARSET_T> const& pat) {
+    return pat.char_set();
+  }
+};
+
+template <typename PAT_T>
+struct skip_char_set<Discard<PAT_T>> : public skip_char_set<PAT_T> {
+  static auto const& get(Discard<PAT_T> const& pat) {
+    return skip_char_set<PAT_T>::get(pat.operand());
+  }
+};
+
+// Repeating a run of at least two characters could leave one behind.
+template <typename CHARSET_T, int MIN_REP, int MAX_REP>
+struct skip_char_set<Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP>>
+    : public std::integral_constant<bool, MIN_REP <= 1> {
+  static auto const& get(
+      Repeat<Char<CHARSET_T>, MIN_REP, MAX_REP> const& pat) {
+    return pat.operand().char_set();
+  }
+};
+
+// This is what optimize() makes out of an alternative of characters.
+template <typename PAT_T>
+struct skip_char_set<Alt<PAT_T>> : public skip_char_set<PAT_T> {
+  static auto const& get(Alt<PAT_T> const& pat) {
+    return skip_char_set<PAT_T>::get(std::get<0>(pat.childs()));
+  }
+};
+
+// Patterns that only ever consume data through children parsed in the same
+// context. Since these children skip on their own, skipping ahead of the
+// parent as well would only scan the same spot twice.
+template <typename PAT_T>
+struct skips_in_childs : public std::false_type {};
+
+// Runs the skipper of ctx, provided skip_char_set<> recognizes it. Returns
+// PARTIAL if more data could still be skipped once it comes in.
+template <typename CTX_T>
+Result skip_chars(CTX_T ctx) {
+  using skip_t = typename CTX_T::skip_pattern_t;
+  auto const& chars = skip_char_set<skip_t>::get(ctx.skipper());
+  auto& data = ctx.data();
+
+  if constexpr (CTX_T::IS_CONTIGUOUS) {
+    auto remaining = data.remaining();
+    data.advance(scan_run(chars, remaining.data(), remaining.size()));
+  } else {
+    while (!data.empty() && chars.is_valid(data.next())) {
+      data.advance();
+    }
+  }
+
+  if (data.empty() && !data.final_buffer()) {
+    return Result::PARTIAL;
+  }
+  return Result::SUCCESS;
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
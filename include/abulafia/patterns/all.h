@@ -20,10 +20,13 @@
 #include "abulafia/patterns/leaf/character.h"
 #include "abulafia/patterns/leaf/eoi.h"
 #include "abulafia/patterns/leaf/fail.h"
+#include "abulafia/patterns/leaf/hashed_symbol.h"
 #include "abulafia/patterns/leaf/pass.h"
 #include "abulafia/patterns/leaf/string_literal.h"
 #include "abulafia/patterns/leaf/string_symbol.h"
+#include "abulafia/patterns/leaf/token.h"
 
+#include "abulafia/patterns/leaf/numeric/float.h"
 #include "abulafia/patterns/leaf/numeric/int.h"
 #include "abulafia/patterns/leaf/numeric/uint.h"
 
@@ -35,8 +38,13 @@
 #include "abulafia/patterns/unary/construct.h"
 #include "abulafia/patterns/unary/discard.h"
 #include "abulafia/patterns/unary/lexeme.h"
+#include "abulafia/patterns/unary/memoize.h"
 #include "abulafia/patterns/unary/not.h"
+#include "abulafia/patterns/unary/operators.h"
 #include "abulafia/patterns/unary/optional.h"
 #include "abulafia/patterns/unary/repeat.h"
 
+// Pattern rewriting
+#include "abulafia/patterns/optimize.h"
+
 #endif
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 #include <utility>
@@ -32,6 +33,11 @@ class Except : public Pattern<Except<OP_T, NEG_T>> {
   neg_t const& neg() const { return neg_; }
 };
 
+template <typename OP_T, typename NEG_T>
+FirstSet first_set(Except<OP_T, NEG_T> const& pat) {
+  return first_set(pat.op());
+}
+
 template <typename OP_T, typename NEG_T>
 auto except(OP_T lhs, NEG_T rhs) {
   return Except<pattern_t<OP_T>, pattern_t<NEG_T>>(
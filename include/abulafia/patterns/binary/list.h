@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 #include <utility>
@@ -31,6 +32,11 @@ class List : public Pattern<List<OP_T, SEP_PAT_T>> {
   SEP_PAT_T sep_;
 };
 
+template <typename OP_T, typename SEP_PAT_T>
+FirstSet first_set(List<OP_T, SEP_PAT_T> const& pat) {
+  return first_set(pat.op());
+}
+
 template <typename LHS_T, typename RHS_T>
 auto list(LHS_T lhs, RHS_T rhs) {
   return List<pattern_t<LHS_T>, pattern_t<RHS_T>>(make_pattern(std::move(lhs)),
@@ -0,0 +1,57 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_FIRST_SET_H_
+#define ABULAFIA_PATTERNS_FIRST_SET_H_
+
+#include "abulafia/config.h"
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace ABULAFIA_NAMESPACE {
+
+// The set of 8-bit characters a match of a pattern can start with. A nullable
+// pattern may succeed without consuming anything, so it cannot be ruled out,
+// whatever the next character is.
+struct FirstSet {
+  std::bitset<256> chars;
+  bool nullable = false;
+
+  // Used for patterns that cannot be analyzed.
+  static FirstSet unknown() {
+    FirstSet result;
+    result.chars.set();
+    result.nullable = true;
+    return result;
+  }
+
+  template <typename CHAR_T>
+  void add(CHAR_T c) {
+    chars.set(std::uint8_t(c));
+  }
+
+  // Wether the pattern can match input starting with c.
+  bool accepts(std::size_t c) const { return nullable || chars[c]; }
+
+  FirstSet& operator|=(FirstSet const& rhs) {
+    chars |= rhs.chars;
+    nullable = nullable || rhs.nullable;
+    return *this;
+  }
+};
+
+// Patterns opt into the analysis by overloading first_set().
+template <typename PAT_T>
+FirstSet first_set(PAT_T const&) {
+  return FirstSet::unknown();
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
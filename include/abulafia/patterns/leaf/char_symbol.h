@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 #include <map>
@@ -26,6 +27,19 @@ class CharSymbol : public Pattern<CharSymbol<CHAR_T, VAL_T>> {
   std::map<CHAR_T, VAL_T> const& mapping() const { return mapping_; }
 };
 
+template <typename CHAR_T, typename VAL_T>
+FirstSet first_set(CharSymbol<CHAR_T, VAL_T> const& pat) {
+  if constexpr (sizeof(CHAR_T) == 1) {
+    FirstSet result;
+    for (auto const& entry : pat.mapping()) {
+      result.add(entry.first);
+    }
+    return result;
+  } else {
+    return FirstSet::unknown();
+  }
+}
+
 template <typename CHAR_T, typename VAL_T>
 auto symbol(std::map<CHAR_T, VAL_T> const& vals) {
   return CharSymbol<CHAR_T, VAL_T>(vals);
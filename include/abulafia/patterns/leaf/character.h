@@ -12,26 +12,49 @@
 
 #include "abulafia/char_set/any.h"
 #include "abulafia/char_set/char_set.h"
+#include "abulafia/char_set/compiled.h"
 #include "abulafia/char_set/range.h"
 #include "abulafia/char_set/set.h"
 #include "abulafia/char_set/single.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 namespace ABULAFIA_NAMESPACE {
 
 // The Character pattern checks the next token against its character
 // set. If the test passes, the next character is emmited and it succeeds.
+// Composite character sets over 8-bit characters are compiled into a lookup
+// table.
 template <typename CHARSET_T>
 class Char : public Pattern<Char<CHARSET_T>> {
-  CHARSET_T char_set_;
-
  public:
-  Char(CHARSET_T chars) : char_set_(std::move(chars)) {}
+  using char_set_t = char_set::compiled_t<CHARSET_T>;
+
+  Char(CHARSET_T const& chars) : char_set_(char_set::compile(chars)) {}
+
+  char_set_t const& char_set() const { return char_set_; }
 
-  CHARSET_T const& char_set() const { return char_set_; }
+ private:
+  char_set_t char_set_;
 };
 
+template <typename CHARSET_T>
+FirstSet first_set(Char<CHARSET_T> const& pat) {
+  using char_t = typename Char<CHARSET_T>::char_set_t::char_t;
+  if constexpr (sizeof(char_t) == 1) {
+    FirstSet result;
+    for (std::size_t i = 0; i < 256; ++i) {
+      if (pat.char_set().is_valid(char_t(i))) {
+        result.add(i);
+      }
+    }
+    return result;
+  } else {
+    return FirstSet::unknown();
+  }
+}
+
 template <typename T = char>
 auto char_() {
   return Char<char_set::Any<T>>(char_set::Any<T>());
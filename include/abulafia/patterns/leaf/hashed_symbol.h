@@ -0,0 +1,59 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_HASHED_SYMBOL_H_
+#define ABULAFIA_PATTERNS_HASHED_SYMBOL_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/char_set/char_set.h"
+#include "abulafia/char_set/compiled.h"
+#include "abulafia/char_set/not.h"
+#include "abulafia/patterns/pattern.h"
+#include "abulafia/support/perfect_hash.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Matches a token that spans until the next character of the terminator set
+// (or the end of the data), and emits the value associated with it. Unlike
+// Symbol, the token has to be a key in its entirety: there is no prefix
+// matching. The terminator itself is not consumed.
+template <typename CHAR_T, typename VAL_T, typename TERM_T>
+class HashedSymbol : public Pattern<HashedSymbol<CHAR_T, VAL_T, TERM_T>> {
+ public:
+  using map_t = PerfectHashMap<CHAR_T, VAL_T>;
+  using token_chars_t = char_set::compiled_t<char_set::Not<TERM_T>>;
+
+  HashedSymbol(std::map<std::basic_string<CHAR_T>, VAL_T> const& vals,
+               TERM_T const& terminators)
+      : map_(std::make_shared<map_t const>(vals)),
+        token_chars_(char_set::compile(char_set::Not<TERM_T>(terminators))) {}
+
+  map_t const& map() const { return *map_; }
+
+  // The characters that can be part of a token.
+  token_chars_t const& token_chars() const { return token_chars_; }
+
+ private:
+  std::shared_ptr<map_t const> map_;
+  token_chars_t token_chars_;
+};
+
+template <typename CHAR_T, typename VAL_T, typename TERM_T>
+auto symbol_hashed(std::map<std::basic_string<CHAR_T>, VAL_T> const& vals,
+                   TERM_T terminators) {
+  auto term_set = char_set::to_char_set(terminators);
+  return HashedSymbol<CHAR_T, VAL_T, decltype(term_set)>(vals, term_set);
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,47 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_LEAF_NUMERIC_FLOAT_H_
+#define ABULAFIA_PATTERNS_LEAF_NUMERIC_FLOAT_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/patterns/first_set.h"
+#include "abulafia/patterns/pattern.h"
+
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Pattern for a decimal floating point number, with an optional sign,
+// fractional part and exponent: [+-]?(d+(.d*)?|.d+)([eE][+-]?d+)?
+// The value is rounded to the nearest T, independently of the locale.
+template <typename T = double>
+class Float : public Pattern<Float<T>> {
+ public:
+  static_assert(std::is_same<T, float>::value ||
+                std::is_same<T, double>::value);
+};
+
+template <typename T>
+FirstSet first_set(Float<T> const&) {
+  FirstSet result;
+  for (char c = '0'; c <= '9'; ++c) {
+    result.add(c);
+  }
+  result.add('.');
+  result.add('-');
+  result.add('+');
+  return result;
+}
+
+static constexpr Float<double> double_;
+static constexpr Float<float> float_;
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -10,6 +10,8 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/parsers/helpers/digit_values.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 namespace ABULAFIA_NAMESPACE {
@@ -22,6 +24,19 @@ class Int : public Pattern<Int<BASE, DIGITS_MIN, DIGITS_MAX>> {
   static_assert(DIGITS_MAX >= DIGITS_MIN || DIGITS_MAX == 0);
 };
 
+template <int BASE, int DIGITS_MIN, int DIGITS_MAX>
+FirstSet first_set(Int<BASE, DIGITS_MIN, DIGITS_MAX> const&) {
+  FirstSet result;
+  for (int c = 0; c < 128; ++c) {
+    if (DigitValues<BASE>::is_valid(char(c))) {
+      result.add(c);
+    }
+  }
+  result.add('-');
+  result.add('+');
+  return result;
+}
+
 static constexpr Int<10, 1, 0> int_;
 
 }  // namespace ABULAFIA_NAMESPACE
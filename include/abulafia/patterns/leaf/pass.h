@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 namespace ABULAFIA_NAMESPACE {
@@ -17,6 +18,12 @@ namespace ABULAFIA_NAMESPACE {
 // The Fail pattern always fails, and does not emit anything.
 class Pass : public Pattern<Pass> {};
 
+inline FirstSet first_set(Pass const&) {
+  FirstSet result;
+  result.nullable = true;
+  return result;
+}
+
 static constexpr Pass pass;
 
 }  // namespace ABULAFIA_NAMESPACE
@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 #include <cassert>
@@ -34,6 +35,17 @@ class StringLiteral : public Pattern<StringLiteral<CHAR_T>> {
   auto end() const { return str_->end(); }
 };
 
+template <typename CHAR_T>
+FirstSet first_set(StringLiteral<CHAR_T> const& pat) {
+  if constexpr (sizeof(CHAR_T) == 1) {
+    FirstSet result;
+    result.add(*pat.begin());
+    return result;
+  } else {
+    return FirstSet::unknown();
+  }
+}
+
 template <typename CHAR_T>
 inline auto lit(CHAR_T const* str) {
   return StringLiteral<decay_t<CHAR_T>>(str);
@@ -10,47 +10,45 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
+#include "abulafia/support/flat_trie.h"
 
 #include <map>
 #include <memory>
-#include <optional>
-#include <stdexcept>
+#include <string>
 
 namespace ABULAFIA_NAMESPACE {
 
 template <typename CHAR_T, typename VAL_T>
 class Symbol : public Pattern<Symbol<CHAR_T, VAL_T>> {
-  // symbols->value map will be stored as a trie
-  struct Node {
-    std::map<CHAR_T, Node> child;
-    std::optional<VAL_T> val;
-  };
-
-  std::shared_ptr<Node> root_;
-
  public:
-  using node_t = Node;
+  using trie_t = FlatTrie<CHAR_T, VAL_T>;
 
+  // The symbols->value map is compiled into a flat trie once, and shared
+  // between all copies of the pattern.
   Symbol(std::map<std::basic_string<CHAR_T>, VAL_T> const& vals)
-      : root_(std::make_shared<Node>()) {
-    for (auto const& entry : vals) {
-      node_t* next = root_.get();
+      : trie_(std::make_shared<trie_t const>(vals)) {}
 
-      for (auto const& chr : entry.first) {
-        next = &next->child[chr];
-      }
+  trie_t const& trie() const { return *trie_; }
 
-      if (next->val) {
-        throw std::runtime_error("cannot have two symbols with the same value");
-      }
+ private:
+  std::shared_ptr<trie_t const> trie_;
+};
 
-      next->val = entry.second;
-    }
+template <typename CHAR_T, typename VAL_T>
+FirstSet first_set(Symbol<CHAR_T, VAL_T> const& pat) {
+  if constexpr (sizeof(CHAR_T) == 1) {
+    auto const& trie = pat.trie();
+    FirstSet result;
+    result.nullable = trie.has_value(trie.root());
+    trie.for_each_edge(trie.root(),
+                       [&](CHAR_T c, auto) { result.add(c); });
+    return result;
+  } else {
+    return FirstSet::unknown();
   }
-
-  Node const* root() const { return root_.get(); }
-};
+}
 
 template <typename CHAR_T, typename VAL_T>
 auto symbol(std::map<std::basic_string<CHAR_T>, VAL_T> const& vals) {
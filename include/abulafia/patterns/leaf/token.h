@@ -0,0 +1,38 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_LEAF_TOKEN_H_
+#define ABULAFIA_PATTERNS_LEAF_TOKEN_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/patterns/pattern.h"
+
+#include <cstddef>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Matches a single Token of the given kind, in data that went through a
+// Lexer. It emits the text of the token.
+class Tok : public Pattern<Tok> {
+ public:
+  explicit Tok(std::size_t kind) : kind_(kind) {}
+
+  std::size_t kind() const { return kind_; }
+
+ private:
+  std::size_t kind_;
+};
+
+template <typename KIND_T>
+Tok tok(KIND_T kind) {
+  return Tok(std::size_t(kind));
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -11,9 +11,15 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/nary/nary_pattern.h"
 #include "abulafia/patterns/pattern.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
 #include <variant>
 
 namespace ABULAFIA_NAMESPACE {
@@ -24,14 +30,78 @@ class Alt : public Pattern<Alt<CHILD_PATS_T...>> {
  public:
   using child_tuple_t = std::tuple<CHILD_PATS_T...>;
 
-  Alt(child_tuple_t childs) : childs_(std::move(childs)) {}
+  // For every possible first character, the index of the first child that
+  // can match input starting with it. unique_branch is set if none of the
+  // following childs can either.
+  using dispatch_table_t = std::array<std::uint8_t, 256>;
+  static constexpr std::uint8_t unique_branch = 0x80;
+
+  Alt(child_tuple_t childs)
+      : childs_(std::move(childs)), dispatch_table_(build_dispatch_table_()) {}
 
   child_tuple_t const& childs() const { return childs_; }
 
+  // Null if dispatching on the first character would not help.
+  dispatch_table_t const* dispatch_table() const {
+    return dispatch_table_.get();
+  }
+
  private:
+  static constexpr std::size_t child_count = sizeof...(CHILD_PATS_T);
+
+  std::shared_ptr<dispatch_table_t const> build_dispatch_table_() const {
+    if (child_count < 2 || child_count >= unique_branch) {
+      return nullptr;
+    }
+
+    auto sets = std::apply(
+        [](auto const&... childs) {
+          return std::array<FirstSet, child_count>{{first_set(childs)...}};
+        },
+        childs_);
+
+    auto table = std::make_shared<dispatch_table_t>();
+    bool useful = false;
+    for (std::size_t c = 0; c < table->size(); ++c) {
+      std::size_t first = 0;
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < child_count; ++i) {
+        if (sets[i].accepts(c)) {
+          if (count == 0) {
+            first = i;
+          }
+          ++count;
+        }
+      }
+
+      // When no child can match, let the last one fail.
+      auto entry = count == 0 ? std::uint8_t((child_count - 1) | unique_branch)
+                              : std::uint8_t(first);
+      if (count == 1) {
+        entry |= unique_branch;
+      }
+      (*table)[c] = entry;
+      useful = useful || entry != 0;
+    }
+
+    if (!useful) {
+      return nullptr;
+    }
+    return table;
+  }
+
   child_tuple_t childs_;
+  std::shared_ptr<dispatch_table_t const> dispatch_table_;
 };
 
+template <typename... CHILD_PATS_T>
+FirstSet first_set(Alt<CHILD_PATS_T...> const& pat) {
+  FirstSet result;
+  std::apply([&](auto const&... childs) { ((result |= first_set(childs)), ...); },
+             pat.childs());
+  return result;
+}
+
 template <int Index, typename... CHILD_PATS_T>
 auto const& getChild(Alt<CHILD_PATS_T...> const& pat) {
   return std::get<Index>(pat.childs());
@@ -11,9 +11,11 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/nary/nary_pattern.h"
 #include "abulafia/patterns/pattern.h"
 
+#include <tuple>
 #include <variant>
 
 namespace ABULAFIA_NAMESPACE {
@@ -37,6 +39,25 @@ auto const& getChild(Seq<CHILD_PATS_T...> const& pat) {
   return std::get<Index>(pat.childs());
 }
 
+// A sequence can start where its first child can, and where the following
+// ones can for as long as the previous ones can match nothing.
+template <typename... CHILD_PATS_T>
+FirstSet first_set(Seq<CHILD_PATS_T...> const& pat) {
+  FirstSet result;
+  result.nullable = true;
+
+  auto add_child = [&](auto const& child) {
+    if (result.nullable) {
+      auto child_set = first_set(child);
+      result.chars |= child_set.chars;
+      result.nullable = child_set.nullable;
+    }
+  };
+  std::apply([&](auto const&... childs) { (add_child(childs), ...); },
+             pat.childs());
+  return result;
+}
+
 template <typename... CHILD_PATS_T>
 auto seq(CHILD_PATS_T&&... childs) {
   return Seq<CHILD_PATS_T...>(
@@ -0,0 +1,437 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_OPTIMIZE_H_
+#define ABULAFIA_PATTERNS_OPTIMIZE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/parser.h"
+#include "abulafia/char_set/compiled.h"
+#include "abulafia/char_set/or.h"
+#include "abulafia/char_set/single.h"
+#include "abulafia/patterns/binary/except.h"
+#include "abulafia/patterns/binary/list.h"
+#include "abulafia/patterns/leaf/character.h"
+#include "abulafia/patterns/leaf/fail.h"
+#include "abulafia/patterns/leaf/pass.h"
+#include "abulafia/patterns/leaf/string_literal.h"
+#include "abulafia/patterns/nary/alternative.h"
+#include "abulafia/patterns/nary/sequence.h"
+#include "abulafia/patterns/unary/action.h"
+#include "abulafia/patterns/unary/bind_dst.h"
+#include "abulafia/patterns/unary/construct.h"
+#include "abulafia/patterns/unary/discard.h"
+#include "abulafia/patterns/unary/lexeme.h"
+#include "abulafia/patterns/unary/not.h"
+#include "abulafia/patterns/unary/optional.h"
+#include "abulafia/patterns/unary/repeat.h"
+#include "abulafia/patterns/with_skipper.h"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ABULAFIA_NAMESPACE {
+
+namespace opt_ {
+
+// Rewrites a pattern into an equivalent one. SKIPPING tells wether a skipper
+// may be active at that point of the tree, which rules out the rewrites that
+// would remove the places where it gets to run.
+//
+// Patterns that are not listed here are kept as is, without looking inside.
+template <typename PAT_T, typename ENABLE = void>
+struct Rewrite {
+  template <bool SKIPPING>
+  static PAT_T apply(PAT_T const& pat) {
+    return pat;
+  }
+};
+
+template <bool SKIPPING, typename PAT_T>
+auto rewrite(PAT_T const& pat) {
+  return Rewrite<PAT_T>::template apply<SKIPPING>(pat);
+}
+
+// Literals that can be fused into a single StringLiteral.
+template <typename PAT_T>
+struct literal_traits {
+  enum { is_literal = false };
+};
+
+template <typename CHAR_T>
+struct literal_traits<Discard<Char<char_set::Single<CHAR_T>>>> {
+  enum { is_literal = true };
+  using char_t = CHAR_T;
+
+  static std::basic_string<CHAR_T> text(
+      Discard<Char<char_set::Single<CHAR_T>>> const& pat) {
+    return std::basic_string<CHAR_T>(1,
+                                     pat.operand().char_set().character());
+  }
+};
+
+template <typename CHAR_T>
+struct literal_traits<StringLiteral<CHAR_T>> {
+  enum { is_literal = true };
+  using char_t = CHAR_T;
+
+  static std::basic_string<CHAR_T> text(StringLiteral<CHAR_T> const& pat) {
+    return std::basic_string<CHAR_T>(pat.begin(), pat.end());
+  }
+};
+
+template <typename LHS_T, typename RHS_T>
+constexpr bool can_fuse() {
+  if constexpr (literal_traits<LHS_T>::is_literal &&
+                literal_traits<RHS_T>::is_literal) {
+    return std::is_same<typename literal_traits<LHS_T>::char_t,
+                        typename literal_traits<RHS_T>::char_t>::value;
+  } else {
+    return false;
+  }
+}
+
+// Character patterns whose sets can be merged into a single one. Discarded
+// characters are only merged with each other, so that the merged pattern
+// emits exactly what the alternative did.
+template <typename PAT_T>
+struct char_traits {
+  enum { is_char = false };
+};
+
+template <typename CHARSET_T>
+struct char_traits<Char<CHARSET_T>> {
+  enum { is_char = true, discarded = false };
+  using char_set_t = typename Char<CHARSET_T>::char_set_t;
+
+  static char_set_t const& chars(Char<CHARSET_T> const& pat) {
+    return pat.char_set();
+  }
+
+  template <typename NEW_CHARSET_T>
+  static auto make(NEW_CHARSET_T chars) {
+    return Char<NEW_CHARSET_T>(chars);
+  }
+};
+
+template <typename CHARSET_T>
+struct char_traits<Discard<Char<CHARSET_T>>> {
+  enum { is_char = true, discarded = true };
+  using char_set_t = typename Char<CHARSET_T>::char_set_t;
+
+  static char_set_t const& chars(Discard<Char<CHARSET_T>> const& pat) {
+    return pat.operand().char_set();
+  }
+
+  template <typename NEW_CHARSET_T>
+  static auto make(NEW_CHARSET_T chars) {
+    return Discard<Char<NEW_CHARSET_T>>(Char<NEW_CHARSET_T>(chars));
+  }
+};
+
+template <typename LHS_T, typename RHS_T>
+constexpr bool can_merge() {
+  if constexpr (char_traits<LHS_T>::is_char && char_traits<RHS_T>::is_char) {
+    using lhs_char_t = typename char_traits<LHS_T>::char_set_t::char_t;
+    using rhs_char_t = typename char_traits<RHS_T>::char_set_t::char_t;
+    return bool(char_traits<LHS_T>::discarded) ==
+               bool(char_traits<RHS_T>::discarded) &&
+           std::is_same<lhs_char_t, rhs_char_t>::value;
+  } else {
+    return false;
+  }
+}
+
+// Alternatives hand the same destination to all their childs, so a nested
+// one can always be lifted into its parent. A nested sequence can only be
+// lifted if that does not change the shape of the destination, i.e. if it
+// emits at most one value.
+template <typename PAT_T>
+struct can_lift : public std::true_type {};
+
+template <typename... CHILD_PATS_T>
+struct can_lift<Seq<CHILD_PATS_T...>>
+    : public std::integral_constant<
+          bool, (0 + ... +
+                 int(ParserFactory<CHILD_PATS_T>::dst_behavior() !=
+                     DstBehavior::IGNORE)) <= 1> {};
+
+// A lone character pattern emits exactly what an alternative of it would.
+template <typename CHILDS_T>
+constexpr bool is_lone_char() {
+  if constexpr (std::tuple_size<CHILDS_T>::value == 1) {
+    using child_t = std::tuple_element_t<0, CHILDS_T>;
+    if constexpr (char_traits<child_t>::is_char) {
+      return !char_traits<child_t>::discarded;
+    }
+  }
+  return false;
+}
+
+template <typename... T, std::size_t... IDS>
+auto drop_last_(std::tuple<T...> const& tup, std::index_sequence<IDS...>) {
+  return std::make_tuple(std::get<IDS>(tup)...);
+}
+
+template <typename... T>
+auto drop_last(std::tuple<T...> const& tup) {
+  return drop_last_(tup, std::make_index_sequence<sizeof...(T) - 1>());
+}
+
+enum class Combine { NONE, FUSE_LITERALS, MERGE_CHARS };
+
+// Appends child to childs, combining it with the last one if possible.
+template <Combine MODE, typename... T, typename CHILD_T>
+auto append(std::tuple<T...> const& childs, CHILD_T const& child) {
+  constexpr std::size_t count = sizeof...(T);
+
+  if constexpr (count == 0) {
+    return std::make_tuple(child);
+  } else {
+    using last_t = std::tuple_element_t<count - 1, std::tuple<T...>>;
+    auto const& last = std::get<count - 1>(childs);
+
+    if constexpr (MODE == Combine::FUSE_LITERALS &&
+                  can_fuse<last_t, CHILD_T>()) {
+      using char_t = typename literal_traits<CHILD_T>::char_t;
+      auto fused = StringLiteral<char_t>(literal_traits<last_t>::text(last) +
+                                         literal_traits<CHILD_T>::text(child));
+      return std::tuple_cat(drop_last(childs), std::make_tuple(fused));
+    } else if constexpr (MODE == Combine::MERGE_CHARS &&
+                         can_merge<last_t, CHILD_T>()) {
+      auto merged = char_traits<CHILD_T>::make(char_set::compile(
+          char_set::or_impl(char_traits<last_t>::chars(last),
+                            char_traits<CHILD_T>::chars(child))));
+      return std::tuple_cat(drop_last(childs), std::make_tuple(merged));
+    } else {
+      return std::tuple_cat(childs, std::make_tuple(child));
+    }
+  }
+}
+
+template <Combine MODE, typename ACC_T>
+auto combine_(ACC_T const& acc) {
+  return acc;
+}
+
+template <Combine MODE, typename ACC_T, typename FIRST_T, typename... REST_T>
+auto combine_(ACC_T const& acc, FIRST_T const& first, REST_T const&... rest) {
+  return combine_<MODE>(append<MODE>(acc, first), rest...);
+}
+
+template <Combine MODE, typename... T>
+auto combine(std::tuple<T...> const& childs) {
+  return std::apply(
+      [](auto const&... c) {
+        std::tuple<> acc;
+        return combine_<MODE>(acc, c...);
+      },
+      childs);
+}
+
+template <template <typename...> typename NARY_T, typename... CHILD_PATS_T>
+auto make_nary(std::tuple<CHILD_PATS_T...> childs) {
+  return NARY_T<CHILD_PATS_T...>(std::move(childs));
+}
+
+// Rewrites the childs of a nary pattern. Childs of the same kind are lifted
+// into their parent, like operator>> and operator| do when building it.
+template <template <typename...> typename NARY_T, bool SKIPPING,
+          typename... CHILD_PATS_T>
+auto rewrite_childs(std::tuple<CHILD_PATS_T...> const& childs) {
+  auto lift = [](auto const& child) {
+    auto new_child = rewrite<SKIPPING>(child);
+    using new_child_t = decltype(new_child);
+
+    if constexpr (detail::is_nary_pattern<new_child_t, NARY_T>() &&
+                  can_lift<new_child_t>::value) {
+      return new_child.childs();
+    } else if constexpr (!SKIPPING &&
+                         detail::is_nary_pattern<Seq<>, NARY_T>() &&
+                         std::is_same<new_child_t, Pass>::value) {
+      // Without a skipper, Pass does nothing at all in a sequence.
+      return std::tuple<>();
+    } else {
+      return std::make_tuple(std::move(new_child));
+    }
+  };
+
+  return std::apply(
+      [&](auto const&... c) { return std::tuple_cat(lift(c)...); }, childs);
+}
+
+template <typename... CHILD_PATS_T>
+struct Rewrite<Seq<CHILD_PATS_T...>> {
+  template <bool SKIPPING>
+  static auto apply(Seq<CHILD_PATS_T...> const& pat) {
+    // Literals are only fused if no skipper could run between them.
+    constexpr Combine mode = SKIPPING ? Combine::NONE : Combine::FUSE_LITERALS;
+    auto childs = combine<mode>(rewrite_childs<Seq, SKIPPING>(pat.childs()));
+
+    if constexpr (std::tuple_size<decltype(childs)>::value == 0) {
+      return Seq<Pass>(std::make_tuple(pass));
+    } else {
+      return make_nary<Seq>(std::move(childs));
+    }
+  }
+};
+
+template <typename... CHILD_PATS_T>
+struct Rewrite<Alt<CHILD_PATS_T...>> {
+  template <bool SKIPPING>
+  static auto apply(Alt<CHILD_PATS_T...> const& pat) {
+    auto childs = combine<Combine::MERGE_CHARS>(
+        rewrite_childs<Alt, SKIPPING>(pat.childs()));
+
+    if constexpr (is_lone_char<decltype(childs)>()) {
+      return std::get<0>(std::move(childs));
+    } else {
+      return make_nary<Alt>(std::move(childs));
+    }
+  }
+};
+
+// +x, when x emits nothing. Repeating it has no visible effect: the first
+// round consumes every x in a row, so the next one can only fail. When x does
+// emit values, the extra level shows up in the destination's shape.
+template <typename PAT_T>
+struct is_silent_plus : public std::false_type {};
+
+template <typename PAT_T>
+struct is_silent_plus<Repeat<PAT_T, 1, 0>>
+    : public std::integral_constant<bool,
+                                    ParserFactory<PAT_T>::dst_behavior() ==
+                                        DstBehavior::IGNORE> {};
+
+// Single-child patterns are rebuilt around their rewritten child.
+template <typename PAT_T, int MIN_REP, int MAX_REP>
+struct Rewrite<Repeat<PAT_T, MIN_REP, MAX_REP>> {
+  template <bool SKIPPING>
+  static auto apply(Repeat<PAT_T, MIN_REP, MAX_REP> const& pat) {
+    auto child = rewrite<SKIPPING>(pat.operand());
+    using child_t = decltype(child);
+
+    // +(+x) is +x, and *(+x) is *x. A skipper would run once more per round
+    // of the outer repetition.
+    if constexpr (!SKIPPING && MIN_REP <= 1 && MAX_REP == 0 &&
+                  is_silent_plus<child_t>::value) {
+      using inner_t = std::decay_t<decltype(child.operand())>;
+      return Repeat<inner_t, MIN_REP, 0>(child.operand());
+    } else {
+      return Repeat<child_t, MIN_REP, MAX_REP>(std::move(child));
+    }
+  }
+};
+
+template <template <typename> typename UNARY_T, typename PAT_T>
+struct UnaryRewrite {
+  template <bool SKIPPING>
+  static auto apply(UNARY_T<PAT_T> const& pat) {
+    auto child = rewrite<SKIPPING>(pat.operand());
+    return UNARY_T<decltype(child)>(std::move(child));
+  }
+};
+
+template <typename PAT_T>
+struct Rewrite<Optional<PAT_T>> : public UnaryRewrite<Optional, PAT_T> {};
+
+template <typename PAT_T>
+struct Rewrite<Not<PAT_T>> : public UnaryRewrite<Not, PAT_T> {};
+
+template <typename PAT_T>
+struct Rewrite<Discard<PAT_T>> : public UnaryRewrite<Discard, PAT_T> {};
+
+template <typename PAT_T>
+struct Rewrite<BindDst<PAT_T>> : public UnaryRewrite<BindDst, PAT_T> {};
+
+template <typename PAT_T>
+struct Rewrite<Lexeme<PAT_T>> {
+  template <bool SKIPPING>
+  static auto apply(Lexeme<PAT_T> const& pat) {
+    auto child = rewrite<false>(pat.operand());
+    return Lexeme<decltype(child)>(std::move(child));
+  }
+};
+
+template <typename CHILD_PAT_T, typename ACT_T>
+struct Rewrite<Action<CHILD_PAT_T, ACT_T>> {
+  template <bool SKIPPING>
+  static auto apply(Action<CHILD_PAT_T, ACT_T> const& pat) {
+    auto child = rewrite<SKIPPING>(pat.child_pattern());
+    return Action<decltype(child), ACT_T>(std::move(child), pat.action());
+  }
+};
+
+template <typename CHILD_PAT_T, typename... ARGS_T>
+struct Rewrite<Construct<CHILD_PAT_T, ARGS_T...>> {
+  template <bool SKIPPING>
+  static auto apply(Construct<CHILD_PAT_T, ARGS_T...> const& pat) {
+    auto child = rewrite<SKIPPING>(pat.child_pattern());
+    return Construct<decltype(child), ARGS_T...>(std::move(child));
+  }
+};
+
+template <typename OP_T, typename SEP_T>
+struct Rewrite<List<OP_T, SEP_T>> {
+  template <bool SKIPPING>
+  static auto apply(List<OP_T, SEP_T> const& pat) {
+    auto op = rewrite<SKIPPING>(pat.op());
+    auto sep = rewrite<SKIPPING>(pat.sep());
+    return List<decltype(op), decltype(sep)>(std::move(op), std::move(sep));
+  }
+};
+
+template <typename OP_T, typename NEG_T>
+struct Rewrite<Except<OP_T, NEG_T>> {
+  template <bool SKIPPING>
+  static auto apply(Except<OP_T, NEG_T> const& pat) {
+    auto op = rewrite<SKIPPING>(pat.op());
+    auto neg = rewrite<SKIPPING>(pat.neg());
+    return Except<decltype(op), decltype(neg)>(std::move(op), std::move(neg));
+  }
+};
+
+// The skipper itself is always used without a skipper.
+template <typename CHILD_PAT_T, typename SKIP_T>
+struct Rewrite<WithSkipper<CHILD_PAT_T, SKIP_T>> {
+  template <bool SKIPPING>
+  static auto apply(WithSkipper<CHILD_PAT_T, SKIP_T> const& pat) {
+    constexpr bool skipping = !std::is_same<SKIP_T, Fail>::value;
+    auto child = rewrite<skipping>(pat.getChild());
+    auto skip = rewrite<false>(pat.getSkip());
+    return WithSkipper<decltype(child), decltype(skip)>(std::move(child),
+                                                       std::move(skip));
+  }
+};
+
+}  // namespace opt_
+
+// Rewrites pat into an equivalent, but leaner, pattern:
+//  - Nested sequences and alternatives are flattened.
+//  - Pass is removed from sequences.
+//  - Adjacent literals in a sequence are fused into a single StringLiteral.
+//  - Adjacent character patterns in an alternative are merged into a single
+//    one, over the union of their character sets.
+//  - Unbounded repetitions of +x, where x emits nothing, become repetitions
+//    of x.
+//
+// The result is meant to be parsed as is: rewrites that would change where a
+// skipper runs are not performed under apply_skipper(), so the skipper must
+// be applied before optimizing, not after. Recur, Memoize and Operators
+// patterns are left untouched.
+template <typename PAT_T>
+auto optimize(PAT_T const& pat) {
+  return opt_::rewrite<false>(make_pattern(pat));
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/patterns/pattern.h"
+#include "abulafia/support/arena.h"
 #include "abulafia/support/type_traits.h"
 
 #include <memory>
@@ -21,32 +22,37 @@ struct RecurPayload {
   virtual ~RecurPayload() {}
 };
 
+// Owns the patterns bound to Recur instances. They are all allocated in a
+// single arena, and live as long as the pool.
 struct RecurMemoryPool {
-  std::unique_ptr<RecurPayload>* alloc() {
-    handles_.emplace_back();
-    return &handles_.back();
+  RecurPayload** alloc() { return arena_.create<RecurPayload*>(nullptr); }
+
+  template <typename PAYLOAD_T>
+  PAYLOAD_T* create(PAYLOAD_T payload) {
+    return arena_.create<PAYLOAD_T>(std::move(payload));
   }
 
  private:
-  std::deque<std::unique_ptr<RecurPayload>> handles_;
+  Arena arena_;
 };
 
 // Recur is broken up in two separate types: Recur and RecurUsage, in order
 // to break ref-count loops.
 template <typename CHILD_PAT_T, typename ATTR_T = Nil>
 class Recur : public Pattern<Recur<CHILD_PAT_T, ATTR_T>> {
-  std::unique_ptr<RecurPayload>* pat_;
+  RecurPayload** pat_;
+  RecurMemoryPool* pool_;
 
  public:
   using operand_pat_t = CHILD_PAT_T;
   using attr_t = ATTR_T;
 
-  Recur(RecurMemoryPool& pool) : pat_(pool.alloc()) {}
+  Recur(RecurMemoryPool& pool) : pat_(pool.alloc()), pool_(&pool) {}
   Recur(Recur const& rhs) = default;
   Recur(Recur&& rhs) = default;
 
   Recur& operator=(CHILD_PAT_T rhs) {
-    *pat_ = std::make_unique<CHILD_PAT_T>(std::move(rhs));
+    *pat_ = pool_->create(std::move(rhs));
     return *this;
   }
 
@@ -13,6 +13,8 @@
 #include "abulafia/support/nil.h"
 #include "abulafia/support/type_traits.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 
 namespace ABULAFIA_NAMESPACE {
@@ -52,6 +54,46 @@ template <typename T>
 using pattern_t =
     decay_t<decltype(expr_traits<decay_t<T>>::make_pattern(std::declval<T>()))>;
 
+// Static nesting depth of a pattern tree. Recur patterns are not followed, so
+// this is only a lower bound for recursive grammars.
+template <typename T>
+struct pattern_depth : public std::integral_constant<std::size_t, 1> {};
+
+template <typename T>
+constexpr std::size_t child_pattern_depth() {
+  if constexpr (is_pattern<T>()) {
+    return pattern_depth<T>::value;
+  } else {
+    return 0;
+  }
+}
+
+template <template <typename...> typename PAT_T, typename... ARGS_T>
+struct pattern_depth<PAT_T<ARGS_T...>>
+    : public std::integral_constant<
+          std::size_t,
+          1 + std::max({std::size_t(0), child_pattern_depth<ARGS_T>()...})> {
+};
+
+// Wether memoize() appears in a pattern tree. Recur patterns are not
+// followed either.
+template <typename T>
+struct uses_memo_cache : public std::false_type {};
+
+template <typename T>
+constexpr bool child_uses_memo_cache() {
+  if constexpr (is_pattern<T>()) {
+    return uses_memo_cache<T>::value;
+  } else {
+    return false;
+  }
+}
+
+template <template <typename...> typename PAT_T, typename... ARGS_T>
+struct uses_memo_cache<PAT_T<ARGS_T...>>
+    : public std::integral_constant<
+          bool, (false || ... || child_uses_memo_cache<ARGS_T>())> {};
+
 // Utility function to make a pattern out of a value (if possible).
 template <typename T>
 inline auto make_pattern(T&& p) {
@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/support/function_traits.h"
 
@@ -29,6 +30,11 @@ class Action : public Pattern<Action<CHILD_PAT_T, ACT_T>> {
   ACT_T const& action() const { return act_; }
 };
 
+template <typename CHILD_PAT_T, typename ACT_T>
+FirstSet first_set(Action<CHILD_PAT_T, ACT_T> const& pat) {
+  return first_set(pat.child_pattern());
+}
+
 template <typename PAT_T, typename ACT_T>
 auto apply_action(PAT_T&& pat, ACT_T&& act) {
   return Action<std::decay_t<PAT_T>, std::decay_t<ACT_T>>(
@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/support/assert.h"
 
@@ -25,6 +26,11 @@ class BindDst : public Pattern<BindDst<PAT_T>> {
   PAT_T const& operand() const { return child_; }
 };
 
+template <typename PAT_T>
+FirstSet first_set(BindDst<PAT_T> const& pat) {
+  return first_set(pat.operand());
+}
+
 template <typename PAT_T>
 inline auto bind_dst(PAT_T pat) {
   return BindDst<pattern_t<PAT_T>>(make_pattern(std::move(pat)));
@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/support/function_traits.h"
 
@@ -25,6 +26,11 @@ class Construct : public Pattern<Construct<CHILD_PAT_T, ARGS_T...>> {
   CHILD_PAT_T const& child_pattern() const { return pat_; }
 };
 
+template <typename CHILD_PAT_T, typename... ARGS_T>
+FirstSet first_set(Construct<CHILD_PAT_T, ARGS_T...> const& pat) {
+  return first_set(pat.child_pattern());
+}
+
 // !pattern
 template <typename... ARGS_T, typename CHILD_PAT_T>
 auto construct(CHILD_PAT_T pat) {
@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 
 namespace ABULAFIA_NAMESPACE {
@@ -25,6 +26,11 @@ class Discard : public Pattern<Discard<PAT_T>> {
   PAT_T const& operand() const { return operand_; }
 };
 
+template <typename PAT_T>
+FirstSet first_set(Discard<PAT_T> const& pat) {
+  return first_set(pat.operand());
+}
+
 template <typename PAT_T>
 auto discard(PAT_T pat) {
   return Discard<pattern_t<PAT_T>>(make_pattern(std::move(pat)));
@@ -10,6 +10,7 @@
 
 #include "abulafia/config.h"
 
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/support/assert.h"
 
@@ -25,6 +26,11 @@ class Lexeme : public Pattern<Lexeme<PAT_T>> {
   PAT_T const& operand() const { return child_; }
 };
 
+template <typename PAT_T>
+FirstSet first_set(Lexeme<PAT_T> const& pat) {
+  return first_set(pat.operand());
+}
+
 template <typename PAT_T>
 inline auto lexeme(PAT_T pat) {
   return Lexeme<pattern_t<PAT_T>>(make_pattern(std::move(pat)));
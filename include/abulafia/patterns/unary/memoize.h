@@ -0,0 +1,56 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_UNARY_MEMOIZE_H_
+#define ABULAFIA_PATTERNS_UNARY_MEMOIZE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/patterns/first_set.h"
+#include "abulafia/patterns/pattern.h"
+#include "abulafia/support/memo_cache.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Remembers the outcome of its operand at every position it is tried at, so
+// that backtracking over it never parses the same input twice (packrat
+// parsing). Only effective on contiguous, non-resumable, data sources.
+// Actions within the operand only run the first time around.
+template <typename PAT_T>
+class Memoize : public Pattern<Memoize<PAT_T>> {
+  PAT_T child_;
+  MemoCache* cache_;
+  std::uint32_t rule_;
+
+ public:
+  Memoize(PAT_T child, MemoCache& cache)
+      : child_(std::move(child)), cache_(&cache), rule_(cache.new_rule()) {}
+
+  PAT_T const& operand() const { return child_; }
+  MemoCache& cache() const { return *cache_; }
+  std::uint32_t rule() const { return rule_; }
+};
+
+template <typename PAT_T>
+FirstSet first_set(Memoize<PAT_T> const& pat) {
+  return first_set(pat.operand());
+}
+
+template <typename PAT_T>
+struct uses_memo_cache<Memoize<PAT_T>> : public std::true_type {};
+
+template <typename PAT_T>
+inline auto memoize(PAT_T pat, MemoCache& cache) {
+  return Memoize<pattern_t<PAT_T>>(make_pattern(std::move(pat)), cache);
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
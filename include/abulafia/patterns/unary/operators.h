@@ -0,0 +1,129 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_PATTERNS_UNARY_OPERATORS_H_
+#define ABULAFIA_PATTERNS_UNARY_OPERATORS_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/patterns/first_set.h"
+#include "abulafia/patterns/leaf/string_symbol.h"
+#include "abulafia/patterns/pattern.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+enum class Assoc { LEFT, RIGHT };
+
+// A set of binary operators that share the same precedence. Each token is
+// mapped to the value that is handed to the combine function.
+template <typename OP_T, typename CHAR_T = char>
+struct OperatorLevel {
+  Assoc assoc;
+  std::map<std::basic_string<CHAR_T>, OP_T> ops;
+};
+
+// Calls the operator itself, for tables of callables.
+struct ApplyOperator {
+  template <typename OP_T, typename VAL_T>
+  VAL_T operator()(OP_T const& op, VAL_T lhs, VAL_T rhs) const {
+    return op(std::move(lhs), std::move(rhs));
+  }
+};
+
+// primary (op primary)*, where the operators are resolved by precedence
+// climbing instead of a ladder of nested patterns.
+// Levels go from loosest to tightest binding, and a token may only appear
+// once in the whole table.
+template <typename PRIMARY_T, typename OP_T, typename CHAR_T,
+          typename COMBINE_T>
+class Operators
+    : public Pattern<Operators<PRIMARY_T, OP_T, CHAR_T, COMBINE_T>> {
+ public:
+  struct OpInfo {
+    OP_T op;
+    std::size_t precedence;
+    Assoc assoc;
+  };
+
+  // Maps each token to its index in the operator table.
+  using op_pat_t = Symbol<CHAR_T, std::size_t>;
+  using levels_t = std::vector<OperatorLevel<OP_T, CHAR_T>>;
+
+  Operators(PRIMARY_T primary, levels_t const& levels, COMBINE_T combine)
+      : primary_(std::move(primary)),
+        op_pat_(tokens_(levels)),
+        ops_(std::make_shared<std::vector<OpInfo> const>(infos_(levels))),
+        combine_(std::move(combine)) {}
+
+  PRIMARY_T const& primary() const { return primary_; }
+  op_pat_t const& op_pattern() const { return op_pat_; }
+  OpInfo const& op_info(std::size_t i) const { return (*ops_)[i]; }
+  COMBINE_T const& combine() const { return combine_; }
+
+ private:
+  static std::map<std::basic_string<CHAR_T>, std::size_t> tokens_(
+      levels_t const& levels) {
+    std::map<std::basic_string<CHAR_T>, std::size_t> result;
+    std::size_t i = 0;
+    for (auto const& level : levels) {
+      for (auto const& op : level.ops) {
+        result.emplace(op.first, i++);
+      }
+    }
+    return result;
+  }
+
+  static std::vector<OpInfo> infos_(levels_t const& levels) {
+    std::vector<OpInfo> result;
+    for (std::size_t prec = 0; prec < levels.size(); ++prec) {
+      for (auto const& op : levels[prec].ops) {
+        result.push_back(OpInfo{op.second, prec, levels[prec].assoc});
+      }
+    }
+    return result;
+  }
+
+  PRIMARY_T primary_;
+  op_pat_t op_pat_;
+  std::shared_ptr<std::vector<OpInfo> const> ops_;
+  COMBINE_T combine_;
+};
+
+template <typename PRIMARY_T, typename OP_T, typename CHAR_T,
+          typename COMBINE_T>
+FirstSet first_set(
+    Operators<PRIMARY_T, OP_T, CHAR_T, COMBINE_T> const& pat) {
+  return first_set(pat.primary());
+}
+
+// combine(op, lhs, rhs) produces the value of a binary operation.
+template <typename OP_T, typename CHAR_T = char, typename PRIMARY_T,
+          typename COMBINE_T>
+auto operators(PRIMARY_T primary,
+               std::vector<OperatorLevel<OP_T, CHAR_T>> const& levels,
+               COMBINE_T combine) {
+  return Operators<pattern_t<PRIMARY_T>, OP_T, CHAR_T, COMBINE_T>(
+      make_pattern(std::move(primary)), levels, std::move(combine));
+}
+
+template <typename OP_T, typename CHAR_T = char, typename PRIMARY_T>
+auto operators(PRIMARY_T primary,
+               std::vector<OperatorLevel<OP_T, CHAR_T>> const& levels) {
+  return operators<OP_T, CHAR_T>(std::move(primary), levels,
+                                 ApplyOperator());
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
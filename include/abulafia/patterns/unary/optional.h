@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/support/assert.h"
 
@@ -28,6 +29,13 @@ class Optional : public Pattern<Optional<PAT_T>> {
   PAT_T const& operand() const { return child_; }
 };
 
+template <typename PAT_T>
+FirstSet first_set(Optional<PAT_T> const& pat) {
+  auto result = first_set(pat.operand());
+  result.nullable = true;
+  return result;
+}
+
 // !pattern
 template <typename PAT_T,
           typename Enable = enable_if_t<is_valid_unary_operand<PAT_T>()>>
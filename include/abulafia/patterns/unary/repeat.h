@@ -11,6 +11,7 @@
 #include "abulafia/config.h"
 
 #include "abulafia/parser.h"
+#include "abulafia/patterns/first_set.h"
 #include "abulafia/patterns/pattern.h"
 #include "abulafia/support/nil.h"
 
@@ -28,6 +29,22 @@ class Repeat : public Pattern<Repeat<PAT_T, MIN_REP, MAX_REP>> {
   PAT_T const& operand() const { return operand_; }
 };
 
+template <typename PAT_T, int MIN_REP, int MAX_REP>
+FirstSet first_set(Repeat<PAT_T, MIN_REP, MAX_REP> const& pat) {
+  auto result = first_set(pat.operand());
+  result.nullable = result.nullable || MIN_REP == 0;
+  return result;
+}
+
+template <typename PAT_T, int MIN_REP, int MAX_REP>
+struct pattern_depth<Repeat<PAT_T, MIN_REP, MAX_REP>>
+    : public std::integral_constant<std::size_t,
+                                    1 + pattern_depth<PAT_T>::value> {};
+
+template <typename PAT_T, int MIN_REP, int MAX_REP>
+struct uses_memo_cache<Repeat<PAT_T, MIN_REP, MAX_REP>>
+    : public uses_memo_cache<PAT_T> {};
+
 template <int MIN_REP = 0, int MAX_REP = 0, typename PAT_T>
 inline auto repeat(PAT_T pat) {
   return Repeat<pattern_t<PAT_T>, MIN_REP, MAX_REP>(
@@ -0,0 +1,181 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_ARENA_H_
+#define ABULAFIA_SUPPORT_ARENA_H_
+
+#include "abulafia/config.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Bump allocator. Memory is handed out from large blocks, and only given back
+// all at once by release().
+//  - Blocks grow geometrically, so n bytes cost O(log n) heap allocations.
+//  - Freeing the most recent allocation rolls the bump pointer back, so
+//    allocations with stack-like lifetimes keep reusing the same memory.
+//  - Objects made with create() are destroyed by release(), in reverse order.
+//  - Released blocks are kept around for the next round of allocations.
+class Arena {
+ public:
+  static constexpr std::size_t default_block_size = 4096;
+  static constexpr std::size_t max_block_size = 1024 * 1024;
+
+  explicit Arena(std::size_t first_block_size = default_block_size)
+      : next_block_size_(first_block_size) {}
+
+  Arena(Arena const&) = delete;
+  Arena& operator=(Arena const&) = delete;
+
+  ~Arena() { release(); }
+
+  void* allocate(std::size_t size, std::size_t align) {
+    if (current_ < blocks_.size()) {
+      if (auto p = allocate_in_(blocks_[current_], size, align)) {
+        return p;
+      }
+    }
+
+    // Look for a block that is large enough among the released ones, and
+    // get a new one if there is none.
+    while (++current_ < blocks_.size()) {
+      blocks_[current_].used = 0;
+      if (auto p = allocate_in_(blocks_[current_], size, align)) {
+        return p;
+      }
+    }
+
+    std::size_t block_size = std::max(next_block_size_, size + align);
+    next_block_size_ = std::min(next_block_size_ * 2, max_block_size);
+    blocks_.push_back(
+        Block{std::unique_ptr<std::byte[]>(new std::byte[block_size]),
+              block_size, 0});
+    current_ = blocks_.size() - 1;
+    return allocate_in_(blocks_.back(), size, align);
+  }
+
+  // Only does something for the most recent allocation.
+  void deallocate(void* p, std::size_t size) {
+    if (current_ >= blocks_.size()) {
+      return;
+    }
+    auto& block = blocks_[current_];
+    auto byte_p = static_cast<std::byte*>(p);
+    if (byte_p + size == block.data.get() + block.used) {
+      block.used = std::size_t(byte_p - block.data.get());
+    }
+  }
+
+  template <typename T, typename... ARGS_T>
+  T* create(ARGS_T&&... args) {
+    void* storage = allocate(sizeof(T), alignof(T));
+    T* result = new (storage) T(std::forward<ARGS_T>(args)...);
+
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+      auto node = new (allocate(sizeof(DtorNode), alignof(DtorNode)))
+          DtorNode{[](void* obj) { static_cast<T*>(obj)->~T(); }, result,
+                   dtors_};
+      dtors_ = node;
+    }
+    return result;
+  }
+
+  // Destroys everything made with create(), and makes all the memory
+  // available again.
+  void release() {
+    while (dtors_) {
+      auto node = dtors_;
+      dtors_ = node->next;
+      node->destroy(node->obj);
+    }
+
+    for (auto& block : blocks_) {
+      block.used = 0;
+    }
+    current_ = 0;
+  }
+
+  std::size_t block_count() const { return blocks_.size(); }
+
+ private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data;
+    std::size_t size;
+    std::size_t used;
+  };
+
+  struct DtorNode {
+    void (*destroy)(void*);
+    void* obj;
+    DtorNode* next;
+  };
+
+  static void* allocate_in_(Block& block, std::size_t size,
+                            std::size_t align) {
+    auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+    auto start = (base + block.used + align - 1) & ~std::uintptr_t(align - 1);
+    if (start + size > base + block.size) {
+      return nullptr;
+    }
+    block.used = std::size_t(start + size - base);
+    return reinterpret_cast<void*>(start);
+  }
+
+  std::vector<Block> blocks_;
+  std::size_t current_ = 0;
+  std::size_t next_block_size_;
+  DtorNode* dtors_ = nullptr;
+};
+
+// Deleter for objects that may or may not live in an arena. Arena-backed
+// objects are destroyed right away, but their memory is only reclaimed if it
+// was the latest allocation.
+class ArenaDeleter {
+ public:
+  ArenaDeleter() = default;
+  explicit ArenaDeleter(Arena* arena) : arena_(arena) {}
+
+  template <typename T>
+  void operator()(T* p) const {
+    if (arena_) {
+      p->~T();
+      arena_->deallocate(p, sizeof(T));
+    } else {
+      delete p;
+    }
+  }
+
+ private:
+  Arena* arena_ = nullptr;
+};
+
+template <typename T>
+using arena_ptr = std::unique_ptr<T, ArenaDeleter>;
+
+// Allocates from arena, or from the heap if it is null.
+template <typename T, typename... ARGS_T>
+arena_ptr<T> make_arena_ptr(Arena* arena, ARGS_T&&... args) {
+  if (arena) {
+    void* storage = arena->allocate(sizeof(T), alignof(T));
+    return arena_ptr<T>(new (storage) T(std::forward<ARGS_T>(args)...),
+                        ArenaDeleter(arena));
+  }
+  return arena_ptr<T>(new T(std::forward<ARGS_T>(args)...));
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,192 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_FLAT_TRIE_H_
+#define ABULAFIA_SUPPORT_FLAT_TRIE_H_
+
+#include "abulafia/config.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Read-only trie, laid out in a handful of contiguous arrays.
+//  - Nodes are numbered in breadth-first order, so the top levels, which are
+//    visited by every lookup, are packed together.
+//  - The edges of each node are stored as a sorted run of characters, with
+//    a parallel array of target nodes.
+//  - When CHAR_T is byte-sized, nodes with a large fan-out also get a dense
+//    row, indexed by character class (only characters that appear in at
+//    least one key get a class), so they are resolved in a single load.
+//  - Values live in their own array, away from the structure.
+template <typename CHAR_T, typename VAL_T>
+class FlatTrie {
+ public:
+  using node_id = std::uint32_t;
+  static constexpr node_id npos = std::numeric_limits<node_id>::max();
+
+  // MAP_T must iterate over (key, value) pairs, keys being unique.
+  template <typename MAP_T>
+  explicit FlatTrie(MAP_T const& vals) {
+    build_(vals);
+  }
+
+  node_id root() const { return 0; }
+
+  // Returns npos if there is no edge for c.
+  node_id child(node_id n, CHAR_T c) const {
+    Node const& node = nodes_[n];
+
+    if constexpr (sizeof(CHAR_T) == 1) {
+      if (node.dense_row != npos) {
+        auto cls = classes_[std::uint8_t(c)];
+        return cls ? dense_[node.dense_row * class_count_ + cls - 1] : npos;
+      }
+    }
+
+    CHAR_T const* b = edge_chars_.data() + node.first_edge;
+    CHAR_T const* e = b + node.edge_count;
+    if (node.edge_count < linear_search_limit) {
+      for (auto p = b; p != e; ++p) {
+        if (*p == c) {
+          return edge_targets_[std::size_t(p - edge_chars_.data())];
+        }
+      }
+      return npos;
+    }
+
+    auto found = std::lower_bound(b, e, c);
+    if (found != e && *found == c) {
+      return edge_targets_[std::size_t(found - edge_chars_.data())];
+    }
+    return npos;
+  }
+
+  bool has_value(node_id n) const { return nodes_[n].value != npos; }
+  VAL_T const& value(node_id n) const { return values_[nodes_[n].value]; }
+  bool is_leaf(node_id n) const { return nodes_[n].edge_count == 0; }
+
+  // Calls cb(c, target) for every edge of n, in increasing character order.
+  template <typename CB_T>
+  void for_each_edge(node_id n, CB_T cb) const {
+    Node const& node = nodes_[n];
+    for (node_id i = node.first_edge; i < node.first_edge + node.edge_count;
+         ++i) {
+      cb(edge_chars_[i], edge_targets_[i]);
+    }
+  }
+
+  std::size_t node_count() const { return nodes_.size(); }
+
+ private:
+  // Nodes with at least this many edges get a dense row.
+  static constexpr node_id dense_threshold = 6;
+  static constexpr node_id linear_search_limit = 8;
+
+  struct Node {
+    node_id first_edge;
+    node_id edge_count;
+    node_id value;
+    node_id dense_row;
+  };
+
+  template <typename MAP_T>
+  void build_(MAP_T const& vals) {
+    // Start with a conventional trie.
+    struct TmpNode {
+      std::map<CHAR_T, std::size_t> child;
+      std::optional<node_id> value;
+    };
+    std::vector<TmpNode> tmp(1);
+
+    for (auto const& entry : vals) {
+      std::size_t current = 0;
+      for (auto const& chr : entry.first) {
+        auto found = tmp[current].child.find(chr);
+        if (found == tmp[current].child.end()) {
+          tmp.emplace_back();
+          found = tmp[current].child.emplace(chr, tmp.size() - 1).first;
+        }
+        current = found->second;
+      }
+      tmp[current].value = node_id(values_.size());
+      values_.push_back(entry.second);
+    }
+
+    // Renumber breadth-first.
+    std::vector<std::size_t> order{0};
+    std::vector<node_id> new_id(tmp.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      for (auto const& edge : tmp[order[i]].child) {
+        new_id[edge.second] = node_id(order.size());
+        order.push_back(edge.second);
+      }
+    }
+
+    nodes_.reserve(order.size());
+    for (auto tmp_id : order) {
+      auto const& src = tmp[tmp_id];
+      nodes_.push_back({node_id(edge_chars_.size()), node_id(src.child.size()),
+                        src.value ? *src.value : npos, npos});
+      for (auto const& edge : src.child) {
+        edge_chars_.push_back(edge.first);
+        edge_targets_.push_back(new_id[edge.second]);
+      }
+    }
+
+    if constexpr (sizeof(CHAR_T) == 1) {
+      build_dense_rows_();
+    }
+  }
+
+  void build_dense_rows_() {
+    for (auto c : edge_chars_) {
+      classes_[std::uint8_t(c)] = 1;
+    }
+    for (auto& cls : classes_) {
+      if (cls) {
+        cls = std::uint16_t(++class_count_);
+      }
+    }
+
+    node_id rows = 0;
+    for (auto& node : nodes_) {
+      if (node.edge_count < dense_threshold) {
+        continue;
+      }
+
+      node.dense_row = rows++;
+      dense_.resize(rows * class_count_, npos);
+      for (node_id i = 0; i < node.edge_count; ++i) {
+        auto cls = classes_[std::uint8_t(edge_chars_[node.first_edge + i])];
+        dense_[node.dense_row * class_count_ + cls - 1] =
+            edge_targets_[node.first_edge + i];
+      }
+    }
+  }
+
+  std::vector<Node> nodes_;
+  std::vector<CHAR_T> edge_chars_;
+  std::vector<node_id> edge_targets_;
+  std::vector<VAL_T> values_;
+
+  // Only used when CHAR_T is byte-sized.
+  std::array<std::uint16_t, 256> classes_{};
+  std::size_t class_count_ = 0;
+  std::vector<node_id> dense_;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
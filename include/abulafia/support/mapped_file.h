@@ -0,0 +1,144 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_MAPPED_FILE_H_
+#define ABULAFIA_SUPPORT_MAPPED_FILE_H_
+
+#include "abulafia/config.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ABULAFIA_NAMESPACE {
+
+// Read-only view of an entire file, mapped in memory.
+// Throws std::system_error if the file cannot be opened or mapped.
+class MappedFile {
+ public:
+  explicit MappedFile(std::string const& path) {
+#if defined(_WIN32)
+    HANDLE file =
+        CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      int err = last_error_();
+      throw_error_(err, "cannot open " + path);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+      int err = last_error_();
+      CloseHandle(file);
+      throw_error_(err, "cannot stat " + path);
+    }
+    size_ = std::size_t(size.QuadPart);
+
+    if (size_ > 0) {
+      HANDLE mapping =
+          CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      int err = mapping ? 0 : last_error_();
+      CloseHandle(file);
+      if (!mapping) {
+        throw_error_(err, "cannot map " + path);
+      }
+
+      data_ = static_cast<char const*>(
+          MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+      err = data_ ? 0 : last_error_();
+      CloseHandle(mapping);
+      if (!data_) {
+        throw_error_(err, "cannot map " + path);
+      }
+    } else {
+      CloseHandle(file);
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      int err = last_error_();
+      throw_error_(err, "cannot open " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      int err = last_error_();
+      ::close(fd);
+      throw_error_(err, "cannot stat " + path);
+    }
+    size_ = std::size_t(st.st_size);
+
+    // mmap() refuses empty mappings, empty files are left unmapped.
+    if (size_ > 0) {
+      void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      int err = mapped == MAP_FAILED ? last_error_() : 0;
+      ::close(fd);
+      if (mapped == MAP_FAILED) {
+        throw_error_(err, "cannot map " + path);
+      }
+
+      // Parsers read forward, let the kernel know so it reads ahead.
+      ::madvise(mapped, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<char const*>(mapped);
+    } else {
+      ::close(fd);
+    }
+#endif
+  }
+
+  MappedFile(MappedFile const&) = delete;
+  MappedFile& operator=(MappedFile const&) = delete;
+
+  ~MappedFile() {
+    if (data_) {
+#if defined(_WIN32)
+      UnmapViewOfFile(data_);
+#else
+      ::munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+  }
+
+  char const* begin() const { return data_; }
+  char const* end() const { return data_ + size_; }
+  std::size_t size() const { return size_; }
+
+ private:
+  // Must be read before anything else gets a chance to overwrite it, which
+  // includes closing handles and building the error message.
+  static int last_error_() {
+#if defined(_WIN32)
+    return int(GetLastError());
+#else
+    return errno;
+#endif
+  }
+
+  [[noreturn]] static void throw_error_(int err, std::string const& what) {
+    throw std::system_error(err, std::system_category(), what);
+  }
+
+  char const* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,185 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_MEMO_CACHE_H_
+#define ABULAFIA_SUPPORT_MEMO_CACHE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/result.h"
+#include "abulafia/support/type_traits.h"
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+
+namespace ABULAFIA_NAMESPACE {
+
+namespace memo_ {
+template <typename T, typename ENABLE = void>
+struct has_capacity : public std::false_type {};
+
+template <typename T>
+struct has_capacity<
+    T, std::void_t<decltype(std::declval<T const&>().capacity())>>
+    : public std::true_type {};
+}  // namespace memo_
+
+// Estimated memory held by a cached value, including what collections keep on
+// the heap. Nested collections are counted all the way down, other types are
+// only counted for their own size.
+template <typename T>
+std::size_t memo_value_size(T const& v) {
+  std::size_t result = sizeof(T);
+  if constexpr (is_collection<T>::value) {
+    using value_t = typename T::value_type;
+    if constexpr (memo_::has_capacity<T>::value) {
+      result += v.capacity() * sizeof(value_t);
+    } else {
+      // Node based: one allocation per element, with a couple of links.
+      result += v.size() * (sizeof(value_t) + 2 * sizeof(void*));
+    }
+
+    if constexpr (is_collection<value_t>::value) {
+      for (auto const& e : v) {
+        result += memo_value_size(e) - sizeof(value_t);
+      }
+    }
+  }
+  return result;
+}
+
+// Outcomes of memoized patterns, keyed by input position and rule.
+//
+// The cache is tied to a single parse: it is flushed automatically the first
+// time it is used by a new one, even if the data sits in the same buffer as
+// before.
+//
+// A cache must not be used by several parses at the same time.
+//
+// Once the estimated memory use would go past the budget, everything is
+// flushed. Since parsing moves forward, the entries that are lost are mostly
+// behind the current position anyways.
+class MemoCache {
+ public:
+  static constexpr std::size_t default_budget = 64 * 1024 * 1024;
+
+  struct Entry {
+    Result result;
+    std::size_t length;
+    std::any value;
+  };
+
+  // rule identifies both the memoized pattern and the type of parser it was
+  // instantiated as, since the same pattern can produce different values
+  // depending on where it is used.
+  struct Key {
+    void const* pos;
+    void const* rule_type;
+    std::uint32_t rule;
+
+    bool operator==(Key const& rhs) const {
+      return pos == rhs.pos && rule_type == rhs.rule_type && rule == rhs.rule;
+    }
+  };
+
+  explicit MemoCache(std::size_t memory_budget = default_budget)
+      : memory_budget_(memory_budget) {}
+
+  MemoCache(MemoCache const&) = delete;
+  MemoCache& operator=(MemoCache const&) = delete;
+
+  std::uint32_t new_rule() { return next_rule_++; }
+
+  // Switches to a different parse, identified by the generation of its data
+  // source.
+  void set_input(std::uint64_t generation) {
+    if (generation != generation_) {
+      clear();
+      generation_ = generation;
+    }
+  }
+
+  // Returns nullptr on a miss.
+  Entry const* find(Key const& key) {
+    auto found = entries_.find(key);
+    if (found == entries_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    return &found->second;
+  }
+
+  // value_size is the memory held by entry.value, see memo_value_size().
+  void insert(Key const& key, Entry entry, std::size_t value_size) {
+    std::size_t cost = entry_overhead + value_size;
+    if (memory_used_ + cost > memory_budget_) {
+      entries_.clear();
+      memory_used_ = 0;
+      ++flushes_;
+      if (cost > memory_budget_) {
+        return;
+      }
+    }
+
+    if (entries_.emplace(key, std::move(entry)).second) {
+      memory_used_ += cost;
+    }
+  }
+
+  void clear() {
+    entries_.clear();
+    memory_used_ = 0;
+  }
+
+  std::size_t size() const { return entries_.size(); }
+  std::size_t memory_used() const { return memory_used_; }
+  std::size_t memory_budget() const { return memory_budget_; }
+
+  std::size_t hits() const { return hits_; }
+  std::size_t misses() const { return misses_; }
+  std::size_t flushes() const { return flushes_; }
+
+  void reset_counters() {
+    hits_ = 0;
+    misses_ = 0;
+    flushes_ = 0;
+  }
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(Key const& key) const {
+      auto h = std::hash<void const*>()(key.pos);
+      h ^= std::hash<void const*>()(key.rule_type) + 0x9e3779b9 + (h << 6) +
+           (h >> 2);
+      h ^= std::size_t(key.rule) + 0x9e3779b9 + (h << 6) + (h >> 2);
+      return h;
+    }
+  };
+
+  // Rough cost of a hash node, on top of the value itself.
+  static constexpr std::size_t entry_overhead =
+      sizeof(Key) + sizeof(Entry) + 2 * sizeof(void*);
+
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  std::size_t memory_budget_;
+  std::size_t memory_used_ = 0;
+  std::uint64_t generation_ = 0;
+  std::uint32_t next_rule_ = 0;
+
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+  std::size_t flushes_ = 0;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -46,6 +46,11 @@ struct Nil {
     return *this;
   }
 
+  template <typename T>
+  Nil& operator-=(const T&) {
+    return *this;
+  }
+
   bool operator==(Nil const&) const { return true; }
 
   // Can pose as anything, as long as it can be default-constructed.
@@ -0,0 +1,185 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_PERFECT_HASH_H_
+#define ABULAFIA_SUPPORT_PERFECT_HASH_H_
+
+#include "abulafia/config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+// Read-only map from strings to values, built with a collision-free hash
+// (hash and displace). A lookup costs one hash of the key, two table loads
+// and one comparison against the only candidate.
+template <typename CHAR_T, typename VAL_T>
+class PerfectHashMap {
+ public:
+  // MAP_T must iterate over (key, value) pairs, keys being unique.
+  template <typename MAP_T>
+  explicit PerfectHashMap(MAP_T const& vals) {
+    for (auto const& entry : vals) {
+      key_offsets_.push_back(key_chars_.size());
+      key_chars_.insert(key_chars_.end(), entry.first.begin(),
+                        entry.first.end());
+      values_.push_back(entry.second);
+      max_key_length_ = std::max(max_key_length_, entry.first.size());
+    }
+    key_offsets_.push_back(key_chars_.size());
+
+    for (std::uint64_t salt = 0;; ++salt) {
+      if (salt == max_attempts) {
+        throw std::runtime_error("failed to build a perfect hash");
+      }
+      if (build_(salt)) {
+        break;
+      }
+    }
+  }
+
+  // Returns nullptr if [data, data + len) is not a key.
+  VAL_T const* find(CHAR_T const* data, std::size_t len) const {
+    if (len > max_key_length_ || values_.empty()) {
+      return nullptr;
+    }
+
+    auto h = hash_(data, len);
+    auto seed = seeds_[std::size_t(h % seeds_.size())];
+    auto key = slots_[std::size_t(mix_(h, seed) & slot_mask_)];
+    if (key == empty_slot) {
+      return nullptr;
+    }
+
+    auto key_begin = key_offsets_[key];
+    if (key_offsets_[key + 1] - key_begin != len ||
+        !std::equal(data, data + len, key_chars_.data() + key_begin)) {
+      return nullptr;
+    }
+    return &values_[key];
+  }
+
+  std::size_t max_key_length() const { return max_key_length_; }
+  std::size_t size() const { return values_.size(); }
+
+ private:
+  static constexpr std::uint32_t empty_slot =
+      std::numeric_limits<std::uint32_t>::max();
+  static constexpr std::uint64_t max_attempts = 16;
+
+  static std::uint64_t fmix_(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  static std::uint64_t mix_(std::uint64_t h, std::uint32_t seed) {
+    return fmix_(h ^ (std::uint64_t(seed) * 0x9e3779b97f4a7c15ULL));
+  }
+
+  std::uint64_t hash_(CHAR_T const* data, std::size_t len) const {
+    std::uint64_t h = 0xcbf29ce484222325ULL ^ salt_ ^ len;
+    for (std::size_t i = 0; i < len; ++i) {
+      h = (h ^ std::uint64_t(data[i])) * 0x100000001b3ULL;
+    }
+    return fmix_(h);
+  }
+
+  bool build_(std::uint64_t salt) {
+    salt_ = salt * 0x9e3779b97f4a7c15ULL;
+
+    std::size_t key_count = values_.size();
+    std::size_t slot_count = 1;
+    while (slot_count < key_count + key_count / 4) {
+      slot_count *= 2;
+    }
+    slot_mask_ = slot_count - 1;
+    slots_.assign(slot_count, empty_slot);
+    seeds_.assign(std::max<std::size_t>(1, key_count / 2), 0);
+
+    // Distribute the keys in buckets.
+    std::vector<std::uint64_t> hashes(key_count);
+    std::vector<std::vector<std::uint32_t>> buckets(seeds_.size());
+    for (std::size_t k = 0; k < key_count; ++k) {
+      hashes[k] = hash_(key_chars_.data() + key_offsets_[k],
+                        key_offsets_[k + 1] - key_offsets_[k]);
+      buckets[std::size_t(hashes[k] % seeds_.size())].push_back(
+          std::uint32_t(k));
+    }
+
+    std::vector<std::size_t> order(buckets.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+      return buckets[lhs].size() > buckets[rhs].size();
+    });
+
+    // Place the largest buckets first, looking for a seed that sends all of
+    // their keys to free slots.
+    std::vector<std::size_t> placed;
+    for (auto b : order) {
+      auto const& bucket = buckets[b];
+      if (bucket.empty()) {
+        break;
+      }
+
+      bool found = false;
+      for (std::uint32_t seed = 0; seed < max_seed && !found; ++seed) {
+        placed.clear();
+        found = true;
+        for (auto k : bucket) {
+          auto slot = std::size_t(mix_(hashes[k], seed) & slot_mask_);
+          if (slots_[slot] != empty_slot) {
+            found = false;
+            break;
+          }
+          slots_[slot] = k;
+          placed.push_back(slot);
+        }
+
+        if (found) {
+          seeds_[b] = seed;
+        } else {
+          for (auto slot : placed) {
+            slots_[slot] = empty_slot;
+          }
+        }
+      }
+
+      if (!found) {
+        // Most likely two keys with the same hash, try another salt.
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static constexpr std::uint32_t max_seed = 1 << 16;
+
+  std::vector<CHAR_T> key_chars_;
+  std::vector<std::size_t> key_offsets_;
+  std::vector<VAL_T> values_;
+  std::size_t max_key_length_ = 0;
+
+  std::uint64_t salt_ = 0;
+  std::vector<std::uint32_t> seeds_;
+  std::vector<std::uint32_t> slots_;
+  std::size_t slot_mask_ = 0;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
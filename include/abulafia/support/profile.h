@@ -0,0 +1,253 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_PROFILE_H_
+#define ABULAFIA_SUPPORT_PROFILE_H_
+
+#include "abulafia/config.h"
+
+#include "abulafia/result.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace ABULAFIA_NAMESPACE {
+
+// Defining ABULAFIA_PROFILE before including abulafia makes every parser
+// record statistics about itself, per pattern type. Every translation unit of
+// a program must agree on it.
+#ifdef ABULAFIA_PROFILE
+constexpr bool profiling_enabled = true;
+#else
+constexpr bool profiling_enabled = false;
+#endif
+
+// What was recorded for one pattern type. A parse attempt is a call, however
+// many times it had to be resumed.
+//  - bytes is the net amount of data consumed, only tracked on contiguous
+//    data sources.
+//  - rollbacks counts the failures after which the data had to be rewound.
+//  - total_ns includes the time spent in child patterns, self_ns does not.
+//    Recursive patterns count the time of their nested calls once per level.
+struct ProfileEntry {
+  explicit ProfileEntry(std::string n);
+
+  std::string name;
+
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> successes{0};
+  std::atomic<std::uint64_t> failures{0};
+  std::atomic<std::uint64_t> partials{0};
+  std::atomic<std::uint64_t> rollbacks{0};
+  std::atomic<std::uint64_t> bytes{0};
+  std::atomic<std::uint64_t> total_ns{0};
+  std::atomic<std::uint64_t> self_ns{0};
+};
+
+namespace profile_ {
+struct Registry {
+  std::mutex mutex;
+  std::vector<ProfileEntry*> entries;
+};
+
+inline Registry& registry() {
+  static Registry instance;
+  return instance;
+}
+
+// Time spent in the childs of the innermost running parser of this thread.
+inline std::uint64_t*& current_childs_ns() {
+  thread_local std::uint64_t* current = nullptr;
+  return current;
+}
+
+template <typename T>
+std::string type_name() {
+  char const* mangled = typeid(T).name();
+#if defined(__GNUG__)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void*)> demangled(
+      abi::__cxa_demangle(mangled, nullptr, nullptr, &status), std::free);
+  if (status == 0) {
+    return demangled.get();
+  }
+#endif
+  return mangled;
+}
+
+inline void write_json_string(std::ostream& out, std::string const& str) {
+  out << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      out << '\\';
+    }
+    out << c;
+  }
+  out << '"';
+}
+}  // namespace profile_
+
+inline ProfileEntry::ProfileEntry(std::string n) : name(std::move(n)) {
+  auto& reg = profile_::registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  reg.entries.push_back(this);
+}
+
+namespace profile_ {
+template <typename PAT_T>
+ProfileEntry& entry() {
+  static ProfileEntry instance(type_name<PAT_T>());
+  return instance;
+}
+}  // namespace profile_
+
+// The entry shared by all patterns of type PAT_T.
+template <typename PAT_T>
+ProfileEntry& profile_entry() {
+  return profile_::entry<std::decay_t<PAT_T>>();
+}
+
+// Data left to parse, as far as profiling is concerned.
+template <typename CTX_T>
+std::size_t profile_remaining(CTX_T ctx) {
+  if constexpr (CTX_T::IS_CONTIGUOUS) {
+    return ctx.data().remaining().size();
+  } else {
+    (void)ctx;
+    return 0;
+  }
+}
+
+// Times one call to a parser, and records its outcome.
+class ProfileScope {
+  using clock_t = std::chrono::steady_clock;
+
+ public:
+  ProfileScope(ProfileEntry& entry, std::size_t remaining)
+      : entry_(entry),
+        parent_childs_ns_(profile_::current_childs_ns()),
+        remaining_(remaining),
+        start_(clock_t::now()) {
+    profile_::current_childs_ns() = &childs_ns_;
+  }
+
+  ProfileScope(ProfileScope const&) = delete;
+  ProfileScope& operator=(ProfileScope const&) = delete;
+
+  void finish(Result status, bool rolls_back, std::size_t remaining) {
+    auto relaxed = std::memory_order_relaxed;
+    switch (status) {
+      case Result::SUCCESS:
+        entry_.calls.fetch_add(1, relaxed);
+        entry_.successes.fetch_add(1, relaxed);
+        break;
+      case Result::FAILURE:
+        entry_.calls.fetch_add(1, relaxed);
+        entry_.failures.fetch_add(1, relaxed);
+        if (rolls_back) {
+          entry_.rollbacks.fetch_add(1, relaxed);
+        }
+        break;
+      case Result::PARTIAL:
+        entry_.partials.fetch_add(1, relaxed);
+        break;
+    }
+    if (remaining_ > remaining) {
+      entry_.bytes.fetch_add(remaining_ - remaining, relaxed);
+    }
+  }
+
+  ~ProfileScope() {
+    using std::chrono::nanoseconds;
+    std::uint64_t elapsed =
+        std::chrono::duration_cast<nanoseconds>(clock_t::now() - start_)
+            .count();
+    entry_.total_ns.fetch_add(elapsed, std::memory_order_relaxed);
+    entry_.self_ns.fetch_add(elapsed - std::min(elapsed, childs_ns_),
+                             std::memory_order_relaxed);
+
+    profile_::current_childs_ns() = parent_childs_ns_;
+    if (parent_childs_ns_) {
+      *parent_childs_ns_ += elapsed;
+    }
+  }
+
+ private:
+  ProfileEntry& entry_;
+  std::uint64_t* parent_childs_ns_;
+  std::uint64_t childs_ns_ = 0;
+  std::size_t remaining_;
+  clock_t::time_point start_;
+};
+
+// Writes everything recorded so far as a JSON array, costliest patterns
+// first. Patterns that were never run are left out.
+inline void profile_report(std::ostream& out) {
+  auto& reg = profile_::registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+
+  std::vector<ProfileEntry const*> entries;
+  for (auto const* entry : reg.entries) {
+    if (entry->calls || entry->partials) {
+      entries.push_back(entry);
+    }
+  }
+  std::sort(entries.begin(), entries.end(), [](auto lhs, auto rhs) {
+    return lhs->self_ns > rhs->self_ns;
+  });
+
+  out << "[";
+  bool first = true;
+  for (auto const* entry : entries) {
+    out << (first ? "\n" : ",\n") << "  {\"pattern\": ";
+    profile_::write_json_string(out, entry->name);
+    out << ", \"calls\": " << entry->calls
+        << ", \"successes\": " << entry->successes
+        << ", \"failures\": " << entry->failures
+        << ", \"partials\": " << entry->partials
+        << ", \"rollbacks\": " << entry->rollbacks
+        << ", \"bytes\": " << entry->bytes
+        << ", \"total_ns\": " << entry->total_ns
+        << ", \"self_ns\": " << entry->self_ns << "}";
+    first = false;
+  }
+  out << "\n]\n";
+}
+
+// Forgets everything recorded so far.
+inline void profile_reset() {
+  auto& reg = profile_::registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+
+  for (auto* entry : reg.entries) {
+    for (auto* counter :
+         {&entry->calls, &entry->successes, &entry->failures, &entry->partials,
+          &entry->rollbacks, &entry->bytes, &entry->total_ns,
+          &entry->self_ns}) {
+      counter->store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
@@ -0,0 +1,81 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ABULAFIA_SUPPORT_SMALL_STACK_H_
+#define ABULAFIA_SUPPORT_SMALL_STACK_H_
+
+#include "abulafia/config.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ABULAFIA_NAMESPACE {
+
+// A stack that keeps its first INLINE_CAPACITY entries in inline storage, and
+// only goes to the heap once that is exhausted.
+template <typename T, std::size_t INLINE_CAPACITY>
+class SmallStack {
+ public:
+  void push(T v) {
+    if (size_ < INLINE_CAPACITY) {
+      inline_[size_] = std::move(v);
+    } else {
+      overflow_.push_back(std::move(v));
+    }
+    ++size_;
+  }
+
+  void pop() {
+    assert(!empty());
+    if (size_ > INLINE_CAPACITY) {
+      overflow_.pop_back();
+    } else {
+      // Don't keep whatever the popped value owns alive.
+      inline_[size_ - 1] = T();
+    }
+    --size_;
+  }
+
+  T const& top() const {
+    assert(!empty());
+    if (size_ > INLINE_CAPACITY) {
+      return overflow_.back();
+    }
+    return inline_[size_ - 1];
+  }
+
+  T& top() {
+    assert(!empty());
+    if (size_ > INLINE_CAPACITY) {
+      return overflow_.back();
+    }
+    return inline_[size_ - 1];
+  }
+
+  bool empty() const { return size_ == 0; }
+  std::size_t size() const { return size_; }
+
+  void clear() {
+    overflow_.clear();
+    for (std::size_t i = 0; i < size_ && i < INLINE_CAPACITY; ++i) {
+      inline_[i] = T();
+    }
+    size_ = 0;
+  }
+
+ private:
+  std::array<T, INLINE_CAPACITY> inline_{};
+  std::vector<T> overflow_;
+  std::size_t size_ = 0;
+};
+
+}  // namespace ABULAFIA_NAMESPACE
+
+#endif
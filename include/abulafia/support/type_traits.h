@@ -58,6 +58,25 @@ struct is_collection<std::deque<T, ALLOC>> : public std::true_type {};
 template <typename C, typename T, typename A>
 struct is_collection<std::basic_string<C, T, A>> : public std::true_type {};
 
+// Contiguous iterators
+// C++17 has no way to detect contiguity, so we only recognize iterators over
+// character types that are known to be backed by contiguous memory.
+template <typename T, typename CHAR_T>
+struct is_contiguous_iterator_over
+    : public is_one_of<T, CHAR_T*, CHAR_T const*,
+                       typename std::basic_string<CHAR_T>::iterator,
+                       typename std::basic_string<CHAR_T>::const_iterator,
+                       typename std::vector<CHAR_T>::iterator,
+                       typename std::vector<CHAR_T>::const_iterator> {};
+
+template <typename T>
+struct is_contiguous_iterator
+    : public std::integral_constant<
+          bool, is_contiguous_iterator_over<T, char>::value ||
+                    is_contiguous_iterator_over<T, wchar_t>::value ||
+                    is_contiguous_iterator_over<T, char16_t>::value ||
+                    is_contiguous_iterator_over<T, char32_t>::value> {};
+
 template <typename T, typename ENABLE = void>
 struct reset_if_collection {
   static void exec(T&) {}
@@ -0,0 +1,61 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <random>
+#include <string>
+
+using namespace abu;
+
+// These also run in the _ssse3 and _avx2 variants of the test suite, where
+// scan_run() takes its vectorized paths.
+namespace {
+template <typename CHARSET_T>
+void check_scan_run(CHARSET_T const& set) {
+  auto compiled = char_set::compile(set);
+  std::mt19937 rng(12);
+
+  // Mostly members, so that runs get long enough to span several blocks.
+  std::string members;
+  for (int c = 0; c < 256; ++c) {
+    if (set.is_valid(char(c))) {
+      members.push_back(char(c));
+    }
+  }
+
+  for (int round = 0; round < 200; ++round) {
+    std::string data(std::size_t(rng() % 130), '\0');
+    for (auto& c : data) {
+      bool member = !members.empty() && rng() % 64 != 0;
+      c = member ? members[rng() % members.size()] : char(rng() % 256);
+    }
+
+    for (std::size_t offset = 0; offset < 4 && offset <= data.size();
+         ++offset) {
+      std::size_t expected = offset;
+      while (expected < data.size() && set.is_valid(data[expected])) {
+        ++expected;
+      }
+      EXPECT_EQ(expected - offset,
+                scan_run(compiled, data.data() + offset,
+                         data.size() - offset));
+    }
+  }
+}
+}  // namespace
+
+TEST(test_char_run, matches_scalar_loop) {
+  check_scan_run(char_set::range('a', 'z') | char_set::range('0', '9') | '_');
+  check_scan_run(~char_set::range('a', 'z'));
+  check_scan_run(char_set::range(char(0x80), char(0xFF)) | ' ');
+  check_scan_run(char_set::range(char(0x70), char(0x7F)) |
+                 char_set::range(char(0x80), char(0x8F)));
+  check_scan_run(~char_set::single('\0'));
+}
@@ -0,0 +1,87 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <cctype>
+
+using namespace abu;
+
+TEST(test_compiled, matches_original) {
+  auto ident = char_set::range('a', 'z') | char_set::range('0', '9') | '_';
+  auto compiled = char_set::compile(ident);
+
+  static_assert(
+      is_same<decltype(compiled), char_set::Compiled<char>>::value,
+      "composite char sets should be compiled");
+
+  for (int i = -128; i < 128; ++i) {
+    char c = char(i);
+    EXPECT_EQ(ident.is_valid(c), compiled.is_valid(c));
+  }
+}
+
+TEST(test_compiled, negated_delegated) {
+  auto not_space = ~char_set::delegated([](char c) { return c == ' '; });
+  auto compiled = char_set::compile(not_space);
+
+  EXPECT_FALSE(compiled.is_valid(' '));
+  EXPECT_TRUE(compiled.is_valid('a'));
+  EXPECT_TRUE(compiled.is_valid(char(0xE9)));
+}
+
+TEST(test_compiled, constant_expression) {
+  constexpr auto ident = char_set::compile(
+      char_set::range('a', 'z') | char_set::range('0', '9') | '_');
+  static_assert(ident.is_valid('_'));
+  static_assert(ident.is_valid('q'));
+  static_assert(!ident.is_valid('-'));
+  static_assert(ident.nibble_bitmaps()['_' & 0x0F] & (1 << ('_' >> 4)));
+}
+
+TEST(test_compiled, delegated_is_sampled_once) {
+  int calls = 0;
+  bool accept_b = false;
+  auto pat = char_(char_set::delegated([&](char c) {
+    ++calls;
+    return c == 'a' || (c == 'b' && accept_b);
+  }));
+  EXPECT_EQ(256, calls);
+
+  // The callback's answers are frozen once the pattern exists.
+  accept_b = true;
+  std::string data = "b";
+  EXPECT_EQ(Result::FAILURE, parse(data.begin(), data.end(), pat));
+  data = "a";
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pat));
+  EXPECT_EQ(256, calls);
+}
+
+TEST(test_compiled, trivial_sets_are_left_alone) {
+  auto single = char_set::compile(char_set::single('a'));
+  static_assert(
+      is_same<decltype(single), char_set::Single<char>>::value,
+      "single char sets are not worth compiling");
+
+  auto wide = char_set::compile(char_set::range(U'a', U'z'));
+  static_assert(
+      is_same<decltype(wide), char_set::Range<char32_t>>::value,
+      "wide char sets cannot be compiled");
+}
+
+TEST(test_compiled, used_by_char) {
+  auto pat = char_(char_set::range('a', 'z') | char_set::range('0', '9'));
+  static_assert(is_same<decltype(pat)::char_set_t,
+                        char_set::Compiled<char>>::value,
+                "char_ should compile its char set");
+
+  std::string data = "a";
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pat));
+  data = "_";
+  EXPECT_EQ(Result::FAILURE, parse(data.begin(), data.end(), pat));
+}
@@ -0,0 +1,113 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace abu;
+
+TEST(test_container_ring, handles_multiple_buffers) {
+  ContainerRingDataSource<std::string, 4> ctx;
+
+  ctx.add_buffer("ab");
+  ctx.add_buffer("c");
+  ctx.add_buffer("de", IsFinal::FINAL);
+
+  std::string read;
+  while (!ctx.empty()) {
+    read.push_back(ctx.next());
+    ctx.advance();
+  }
+  EXPECT_EQ("abcde", read);
+}
+
+TEST(test_container_ring, releases_consumed_buffers) {
+  std::vector<std::string> released;
+  ContainerRingDataSource<std::string, 2> ctx(
+      [&](std::string&& b) { released.push_back(std::move(b)); });
+
+  ctx.add_buffer("ab");
+  ctx.add_buffer("cd");
+  EXPECT_TRUE(ctx.full());
+
+  ctx.advance();
+  ctx.advance();
+  EXPECT_EQ(std::vector<std::string>({"ab"}), released);
+  EXPECT_FALSE(ctx.full());
+
+  ctx.add_buffer("ef", IsFinal::FINAL);
+  EXPECT_EQ('c', ctx.next());
+}
+
+TEST(test_container_ring, rollback_holds_buffers) {
+  std::vector<std::string> released;
+  ContainerRingDataSource<std::string, 4> ctx(
+      [&](std::string&& b) { released.push_back(std::move(b)); });
+
+  ctx.add_buffer("12");
+  ctx.add_buffer("34");
+  ctx.add_buffer("56", IsFinal::FINAL);
+
+  ctx.advance();
+  ctx.prepare_rollback();
+  ctx.advance();
+  ctx.advance();
+  ctx.advance();
+  EXPECT_EQ('5', ctx.next());
+  EXPECT_TRUE(released.empty());
+
+  ctx.commit_rollback();
+  EXPECT_EQ('2', ctx.next());
+  EXPECT_TRUE(released.empty());
+
+  ctx.prepare_rollback();
+  ctx.advance();
+  ctx.advance();
+  ctx.cancel_rollback();
+  EXPECT_EQ(std::vector<std::string>({"12"}), released);
+  EXPECT_EQ('4', ctx.next());
+}
+
+TEST(test_container_ring, perform_rollback_from_empty) {
+  ContainerRingDataSource<std::string, 2> ctx;
+
+  ctx.add_buffer("12");
+  ctx.prepare_rollback();
+  ctx.advance();
+  ctx.advance();
+  EXPECT_TRUE(ctx.empty());
+
+  ctx.prepare_rollback();
+  ctx.add_buffer("34", IsFinal::FINAL);
+  ctx.advance();
+  ctx.commit_rollback();
+  EXPECT_EQ('3', ctx.next());
+  ctx.commit_rollback();
+  EXPECT_EQ('1', ctx.next());
+}
+
+TEST(test_container_ring, used_by_make_parser) {
+  std::vector<int> dst;
+  auto parser =
+      make_parser<ContainerRingDataSource<std::string, 4>>(list(uint_, ','),
+                                                           dst);
+
+  std::vector<std::string> pool;
+  parser.data().set_release_callback(
+      [&](std::string&& b) { pool.push_back(std::move(b)); });
+
+  parser.data().add_buffer("12,3");
+  EXPECT_EQ(Result::PARTIAL, parser.consume());
+  parser.data().add_buffer("4,5");
+  EXPECT_EQ(Result::PARTIAL, parser.consume());
+  parser.data().add_buffer("6", IsFinal::FINAL);
+  EXPECT_EQ(Result::SUCCESS, parser.consume());
+
+  EXPECT_EQ(std::vector<int>({12, 34, 56}), dst);
+}
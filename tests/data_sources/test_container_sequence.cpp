@@ -202,3 +202,54 @@ TEST(test_container_sequence, cancel_rollback) {
   ctx.commit_rollback();
   EXPECT_EQ('1', ctx.next());
 }
+
+TEST(test_container_sequence, precise_pinning_compacts_held_buffer) {
+  ContainerSequenceDataSource<std::string, RollbackPinning::PRECISE> ctx;
+
+  auto first = std::make_shared<std::string>("123456");
+  ctx.add_buffer(first);
+  ctx.add_buffer("78");
+  ctx.add_buffer("90", IsFinal::FINAL);
+
+  for (int i = 0; i < 4; ++i) {
+    ctx.advance();
+  }
+  ctx.prepare_rollback();
+  ctx.advance();
+  ctx.prepare_rollback();
+  EXPECT_EQ(2, first.use_count());
+
+  // Leaving the buffer only keeps "56" around.
+  ctx.advance();
+  EXPECT_EQ(1, first.use_count());
+  EXPECT_EQ('7', ctx.next());
+
+  ctx.commit_rollback();
+  EXPECT_EQ('6', ctx.next());
+  ctx.commit_rollback();
+  EXPECT_EQ('5', ctx.next());
+
+  std::string rest;
+  while (!ctx.empty()) {
+    rest.push_back(ctx.next());
+    ctx.advance();
+  }
+  EXPECT_EQ("567890", rest);
+}
+
+TEST(test_container_sequence, precise_pinning_keeps_mostly_pinned_buffer) {
+  ContainerSequenceDataSource<std::string, RollbackPinning::PRECISE> ctx;
+
+  auto first = std::make_shared<std::string>("1234");
+  ctx.add_buffer(first);
+  ctx.add_buffer("56", IsFinal::FINAL);
+
+  ctx.advance();
+  ctx.prepare_rollback();
+  for (int i = 0; i < 4; ++i) {
+    ctx.advance();
+  }
+  EXPECT_EQ(2, first.use_count());
+  ctx.commit_rollback();
+  EXPECT_EQ('2', ctx.next());
+}
@@ -0,0 +1,75 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+using namespace abu;
+
+namespace {
+struct TempFile {
+  TempFile(std::string const& name, std::string const& contents)
+      : path((std::filesystem::temp_directory_path() / name).string()) {
+    std::ofstream f(path, std::ios::binary);
+    f << contents;
+  }
+
+  ~TempFile() { std::remove(path.c_str()); }
+
+  std::string path;
+};
+}  // namespace
+
+TEST(test_mapped_file, read_and_rollback) {
+  TempFile file("abu_read_and_rollback", "1234567890");
+
+  MappedFileDataSource<> ctx(file.path);
+  EXPECT_EQ(10U, ctx.file_size());
+  EXPECT_EQ("1234567890", ctx.remaining());
+
+  ctx.prepare_rollback();
+  ctx.advance(4);
+  EXPECT_EQ('5', ctx.next());
+  ctx.commit_rollback();
+  EXPECT_EQ('1', ctx.next());
+}
+
+TEST(test_mapped_file, empty_file) {
+  TempFile file("abu_empty_file", "");
+
+  MappedFileDataSource<> ctx(file.path);
+  EXPECT_TRUE(ctx.empty());
+  EXPECT_EQ(Result::SUCCESS, parse_file(file.path, eoi));
+}
+
+TEST(test_mapped_file, missing_file) {
+  EXPECT_THROW(MappedFileDataSource<>("/this/file/does/not/exist"),
+               std::system_error);
+
+  try {
+    MappedFile file("/this/file/does/not/exist");
+    FAIL();
+  } catch (std::system_error const& e) {
+    EXPECT_EQ(e.code(), std::errc::no_such_file_or_directory);
+  }
+}
+
+TEST(test_mapped_file, parse_file) {
+  TempFile file("abu_parse_file", "12,13,14");
+
+  std::vector<int> dst;
+  EXPECT_EQ(Result::SUCCESS, parse_file(file.path, list(uint_, ','), dst));
+  EXPECT_EQ(std::vector<int>({12, 13, 14}), dst);
+
+  EXPECT_EQ(Result::FAILURE, parse_file(file.path, list(uint_, ';') >> eoi));
+}
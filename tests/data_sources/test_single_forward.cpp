@@ -8,6 +8,8 @@
 #include "abulafia/abulafia.h"
 #include "gtest/gtest.h"
 
+#include <list>
+
 using namespace abu;
 
 TEST(test_single_forward_context, create_from_string) {
@@ -141,3 +143,73 @@ TEST(test_single_forward_context, cancel_rollback) {
   ctx.commit_rollback();
   EXPECT_EQ('1', ctx.next());
 }
+
+TEST(test_single_forward_context, contiguous_remaining) {
+  std::string data = "1234567890";
+
+  SingleForwardDataSource<std::string::const_iterator> ctx(data.cbegin(),
+                                                           data.cend());
+  static_assert(decltype(ctx)::IS_CONTIGUOUS);
+
+  EXPECT_EQ("1234567890", ctx.remaining());
+  ctx.advance(3);
+  EXPECT_EQ('4', ctx.next());
+  EXPECT_EQ("4567890", ctx.remaining());
+
+  ctx.prepare_rollback();
+  ctx.advance(7);
+  EXPECT_TRUE(ctx.empty());
+  EXPECT_TRUE(ctx.remaining().empty());
+  ctx.commit_rollback();
+  EXPECT_EQ("4567890", ctx.remaining());
+}
+
+TEST(test_single_forward_context, contiguous_from_pointers) {
+  char const* data = "abc";
+
+  SingleForwardDataSource<char const*> ctx(data, data + 3);
+  static_assert(decltype(ctx)::IS_CONTIGUOUS);
+  EXPECT_EQ("abc", ctx.remaining());
+
+  SingleForwardDataSource<char const*> empty_ctx(data, data);
+  EXPECT_TRUE(empty_ctx.empty());
+  EXPECT_TRUE(empty_ctx.remaining().empty());
+}
+
+TEST(test_single_forward_context, non_contiguous) {
+  std::list<char> data = {'a', 'b', 'c'};
+
+  SingleForwardDataSource<std::list<char>::iterator> ctx(data.begin(),
+                                                         data.end());
+  static_assert(!decltype(ctx)::IS_CONTIGUOUS);
+  EXPECT_EQ('a', ctx.next());
+}
+
+TEST(test_single_forward_context, rollback_beyond_inline_capacity) {
+  std::string data = "1234567890";
+
+  SingleForwardDataSource<std::string::iterator, 2> ctx(std::begin(data),
+                                                        std::end(data));
+
+  for (int i = 0; i < 5; ++i) {
+    ctx.prepare_rollback();
+    ctx.advance();
+  }
+
+  EXPECT_EQ('6', ctx.next());
+  ctx.commit_rollback();
+  EXPECT_EQ('5', ctx.next());
+  ctx.cancel_rollback();
+  ctx.commit_rollback();
+  EXPECT_EQ('3', ctx.next());
+  ctx.commit_rollback();
+  EXPECT_EQ('2', ctx.next());
+  ctx.commit_rollback();
+  EXPECT_EQ('1', ctx.next());
+}
+
+TEST(test_single_forward_context, pattern_depth) {
+  EXPECT_EQ(1U, pattern_depth<decltype(uint_)>::value);
+  EXPECT_EQ(2U, pattern_depth<decltype(*uint_)>::value);
+  EXPECT_EQ(4U, pattern_depth<decltype(*(uint_ >> ','))>::value);
+}
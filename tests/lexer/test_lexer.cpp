@@ -0,0 +1,114 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace abu;
+
+namespace {
+enum Kind { WHILE, IDENT, NUMBER, ARROW, MINUS, LPAREN, RPAREN };
+
+Lexer<> make_test_lexer() {
+  auto alpha = char_set::range('a', 'z');
+  auto digit = char_set::range('0', '9');
+
+  return LexerBuilder<>()
+      .add(WHILE, "while")
+      .add(IDENT, char_(alpha) >> *char_(alpha | digit))
+      .add(NUMBER, +char_(digit) >> -('.' >> +char_(digit)))
+      .add(ARROW, "->")
+      .add(MINUS, '-')
+      .add(LPAREN, '(')
+      .add(RPAREN, ')')
+      .skip(+char_(" \t\n"))
+      .build();
+}
+
+using tokens_t = std::vector<Token<>>;
+}  // namespace
+
+TEST(test_lexer, longest_match) {
+  auto lexer = make_test_lexer();
+
+  std::string data = "while whiles ->- 12.5 12. x1(";
+  tokens_t tokens;
+  EXPECT_EQ(Result::FAILURE, lexer.tokenize(data, tokens));
+
+  tokens_t expected = {{WHILE, "while"}, {IDENT, "whiles"}, {ARROW, "->"},
+                       {MINUS, "-"},     {NUMBER, "12.5"},  {NUMBER, "12"}};
+  EXPECT_EQ(expected, tokens);
+
+  data = "x1 (-3)\n";
+  tokens.clear();
+  EXPECT_EQ(Result::SUCCESS, lexer.tokenize(data, tokens));
+  expected = {{IDENT, "x1"},
+              {LPAREN, "("},
+              {MINUS, "-"},
+              {NUMBER, "3"},
+              {RPAREN, ")"}};
+  EXPECT_EQ(expected, tokens);
+}
+
+TEST(test_lexer, character_classes) {
+  auto lexer = make_test_lexer();
+
+  // a-z, 0-9, whitespace, '.', '-', '>', '(', ')', the letters of "while",
+  // and everything else.
+  EXPECT_EQ(14u, lexer.class_count());
+}
+
+TEST(test_lexer, token_patterns) {
+  auto lexer = make_test_lexer();
+
+  std::string data = "while (x - 12) ";
+  tokens_t tokens;
+  ASSERT_EQ(Result::SUCCESS, lexer.tokenize(data, tokens));
+
+  auto operand = tok(IDENT) | tok(NUMBER);
+  auto pattern =
+      discard(tok(WHILE)) >> discard(tok(LPAREN)) >>
+      (operand % discard(tok(MINUS))) >> discard(tok(RPAREN)) >> eoi;
+
+  std::vector<std::string> dst;
+  EXPECT_EQ(Result::SUCCESS,
+            parse(tokens.begin(), tokens.end(), pattern, dst));
+  EXPECT_EQ(std::vector<std::string>({"x", "12"}), dst);
+
+  tokens.pop_back();
+  EXPECT_EQ(Result::FAILURE, parse(tokens.begin(), tokens.end(), pattern));
+
+  auto parser = make_parser<std::vector<Token<>>>(pattern);
+  tokens.clear();
+  lexer.tokenize(data, tokens);
+  for (auto const& t : tokens) {
+    parser.data().add_buffer(tokens_t({t}));
+    EXPECT_EQ(Result::PARTIAL, parser.consume());
+  }
+  parser.data().add_buffer(tokens_t(), IsFinal::FINAL);
+  EXPECT_EQ(Result::SUCCESS, parser.consume());
+}
+
+TEST(test_lexer, runs_in_linear_time) {
+  // Every token but the last one makes the scanner read all the way to the
+  // end of the data before settling for a single 'a'.
+  auto lexer = LexerBuilder<>().add(0, 'a').add(1, +char_('a') >> 'b').build();
+
+  for (std::size_t size : {1000, 10000, 100000}) {
+    std::string data(size, 'a');
+    tokens_t tokens;
+    std::size_t transitions = 0;
+    EXPECT_EQ(Result::SUCCESS, lexer.tokenize(data, tokens, transitions));
+    EXPECT_EQ(size, tokens.size());
+    // Without the dead ends, this would be size * (size + 1) / 2.
+    EXPECT_LE(transitions, 5 * size);
+  }
+}
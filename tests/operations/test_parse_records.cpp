@@ -0,0 +1,164 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace abu;
+
+namespace {
+std::string make_lines(unsigned int count) {
+  std::string result;
+  for (unsigned int i = 0; i < count; ++i) {
+    result += std::to_string(i) + "\n";
+  }
+  return result;
+}
+}  // namespace
+
+TEST(test_parse_records, keeps_order) {
+  auto data = make_lines(10000);
+
+  for (std::size_t threads : {1, 3, 8}) {
+    std::vector<unsigned int> dst;
+    EXPECT_EQ(Result::SUCCESS, parse_records(data.begin(), data.end(), uint_,
+                                             '\n', dst, threads));
+
+    ASSERT_EQ(10000u, dst.size());
+    for (unsigned int i = 0; i < dst.size(); ++i) {
+      EXPECT_EQ(i, dst[i]);
+    }
+  }
+}
+
+TEST(test_parse_records, last_separator_is_optional) {
+  std::string data = "1,2\n3\n4,5,6";
+  std::vector<std::vector<int>> dst;
+  EXPECT_EQ(Result::SUCCESS,
+            parse_records(data.begin(), data.end(), int_ % ',', '\n', dst, 2));
+
+  std::vector<std::vector<int>> expected = {{1, 2}, {3}, {4, 5, 6}};
+  EXPECT_EQ(expected, dst);
+
+  data = "";
+  EXPECT_EQ(Result::SUCCESS,
+            parse_records(data.begin(), data.end(), int_ % ',', '\n', dst, 2));
+  EXPECT_TRUE(dst.empty());
+}
+
+TEST(test_parse_records, failure) {
+  auto data = make_lines(1000) + "12a\n" + make_lines(1000);
+
+  std::vector<unsigned int> dst = {42};
+  EXPECT_EQ(Result::FAILURE, parse_records(data.begin(), data.end(), uint_,
+                                           '\n', dst, 4));
+  EXPECT_EQ(std::vector<unsigned int>({42}), dst);
+
+  EXPECT_EQ(Result::FAILURE,
+            parse_records(data.begin(), data.end(), uint_, '\n'));
+  EXPECT_EQ(Result::SUCCESS,
+            parse_records(data.begin(), data.begin() + 1000, uint_, '\n'));
+}
+
+TEST(test_parse_records, exceptions) {
+  auto data = make_lines(1000);
+  auto pattern = uint_[([](unsigned int v) {
+    if (v == 500) {
+      throw std::runtime_error("500");
+    }
+    return v;
+  })];
+
+  std::vector<unsigned int> dst;
+  EXPECT_THROW(parse_records(data.begin(), data.end(), pattern, '\n', dst, 4),
+               std::runtime_error);
+}
+
+TEST(test_parse_records, memoize_is_detected) {
+  MemoCache cache;
+  auto num = memoize(uint_, cache);
+
+  // parse_records() refuses these.
+  static_assert(uses_memo_cache<decltype(num)>::value);
+  static_assert(uses_memo_cache<decltype(*(num >> ','))>::value);
+  static_assert(uses_memo_cache<decltype(repeat<2, 3>(num))>::value);
+  static_assert(!uses_memo_cache<decltype(*(uint_ >> ','))>::value);
+}
+
+namespace {
+auto csv_row() {
+  auto quoted = lit('"') >> *(char_() - '"') >> '"';
+  auto unquoted = *(char_() - char_(",\n\""));
+  return (quoted | unquoted) % ',';
+}
+
+using csv_t = std::vector<std::vector<std::string>>;
+}  // namespace
+
+TEST(test_parse_records_speculative, quoted_separators) {
+  std::string data;
+  csv_t expected;
+  for (int i = 0; i < 2000; ++i) {
+    auto id = std::to_string(i);
+    if (i % 3 == 0) {
+      data += id + ",\"multi\nline\n" + id + "\"\n";
+      expected.push_back({id, "multi\nline\n" + id});
+    } else {
+      data += id + ",plain\n";
+      expected.push_back({id, "plain"});
+    }
+  }
+
+  for (std::size_t threads : {1, 3, 8}) {
+    csv_t dst;
+    EXPECT_EQ(Result::SUCCESS,
+              parse_records_speculative(data.begin(), data.end(), csv_row(),
+                                        '\n', dst, threads));
+    EXPECT_EQ(expected, dst);
+  }
+
+  // Plain splitting cuts through the quoted fields.
+  csv_t dst;
+  EXPECT_EQ(Result::FAILURE, parse_records(data.begin(), data.end(),
+                                           csv_row(), '\n', dst, 8));
+}
+
+TEST(test_parse_records_speculative, misleading_chunks) {
+  // Every line but the first is within a single quoted field, so that all
+  // guesses but the first are wrong.
+  std::string data = "a,\"";
+  for (int i = 0; i < 1000; ++i) {
+    data += "x,y\n";
+  }
+  data += "\"\nb,c\n";
+
+  csv_t dst;
+  EXPECT_EQ(Result::SUCCESS,
+            parse_records_speculative(data.begin(), data.end(), csv_row(),
+                                      '\n', dst, 4));
+  ASSERT_EQ(2u, dst.size());
+  EXPECT_EQ(std::vector<std::string>({"b", "c"}), dst[1]);
+}
+
+TEST(test_parse_records_speculative, failure) {
+  std::string data = "a,b\n\"c\nd\"e\nf\n";
+
+  csv_t dst = {{"untouched"}};
+  EXPECT_EQ(Result::FAILURE,
+            parse_records_speculative(data.begin(), data.end(), csv_row(),
+                                      '\n', dst, 4));
+  EXPECT_EQ(csv_t({{"untouched"}}), dst);
+
+  data = "a,b\n\"c\nd\"\nf";
+  EXPECT_EQ(Result::SUCCESS,
+            parse_records_speculative(data.begin(), data.end(), csv_row(),
+                                      '\n'));
+}
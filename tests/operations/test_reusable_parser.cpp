@@ -0,0 +1,75 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace abu;
+
+TEST(test_reusable_parser, many_inputs) {
+  auto parser = make_reusable_parser<std::vector<int>>(int_ % ',' >> eoi);
+
+  std::vector<std::string> inputs = {"1,2,3", "4", "-5,6", "1,x", "7,8"};
+  std::vector<std::vector<int>> expected = {
+      {1, 2, 3}, {4}, {-5, 6}, {}, {7, 8}};
+
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    std::vector<int> dst;
+    auto status = parser.parse(inputs[i].begin(), inputs[i].end(), dst);
+    EXPECT_EQ(inputs[i] == "1,x" ? Result::FAILURE : Result::SUCCESS, status);
+    if (status == Result::SUCCESS) {
+      EXPECT_EQ(expected[i], dst);
+    }
+  }
+}
+
+TEST(test_reusable_parser, recursion) {
+  // operators() has no direct parser, so the recursion below it goes through
+  // coroutine parsers, which live in the arena.
+  RecurMemoryPool pool;
+  Recur<struct expr_t, int> expr(pool);
+  auto sum = [](char op, int lhs, int rhs) {
+    return op == '+' ? lhs + rhs : lhs - rhs;
+  };
+  ABU_Recur_define(
+      expr, expr_t,
+      operators<char>(uint_ | ('(' >> expr >> ')'),
+                      {{Assoc::LEFT, {{"+", '+'}, {"-", '-'}}}}, sum));
+
+  auto parser = make_reusable_parser<int>(expr >> eoi);
+
+  auto run = [&](std::size_t depth) {
+    std::string data;
+    for (std::size_t i = 0; i < depth; ++i) {
+      data += "1+(";
+    }
+    data += "1";
+    data += std::string(depth, ')');
+
+    int dst = 0;
+    EXPECT_EQ(Result::SUCCESS, parser.parse(data.begin(), data.end(), dst));
+    EXPECT_EQ(int(depth) + 1, dst);
+
+    data += ')';
+    EXPECT_EQ(Result::FAILURE, parser.parse(data.begin(), data.end(), dst));
+  };
+
+  for (std::size_t depth : {100, 3, 500, 0}) {
+    run(depth);
+  }
+  auto blocks = parser.arena().block_count();
+  EXPECT_LT(0u, blocks);
+
+  // The blocks from the first round are enough for the same inputs.
+  for (std::size_t depth : {100, 3, 500, 0}) {
+    run(depth);
+    EXPECT_EQ(blocks, parser.arena().block_count());
+  }
+}
@@ -21,3 +21,73 @@ TEST(test_alternative, simple_test) {
   testPatternSuccess("24", pattern, 24U);
   testPatternFailure<int>("2", pattern);
 }
+
+TEST(test_alternative, first_sets) {
+  auto word = first_set(lit("let"));
+  EXPECT_TRUE(word.accepts('l'));
+  EXPECT_FALSE(word.accepts('e'));
+  EXPECT_FALSE(word.nullable);
+
+  auto seq = first_set(*lit(' ') >> int_);
+  EXPECT_TRUE(seq.accepts(' '));
+  EXPECT_TRUE(seq.accepts('-'));
+  EXPECT_TRUE(seq.accepts('7'));
+  EXPECT_FALSE(seq.accepts('a'));
+  EXPECT_FALSE(seq.nullable);
+
+  auto opt = first_set(-char_('a', 'c'));
+  EXPECT_TRUE(opt.accepts('b'));
+  EXPECT_TRUE(opt.accepts('z'));
+
+  auto unknown = first_set(apply_skipper(lit('a'), lit(' ')));
+  EXPECT_TRUE(unknown.accepts('z'));
+}
+
+TEST(test_alternative, dispatch_disjoint) {
+  auto pattern = (lit('a') >> uint_) | (lit('b') >> uint_) |
+                 (lit("cd") >> uint_) | uint_;
+
+  auto table = pattern.dispatch_table();
+  ASSERT_NE(table, nullptr);
+  EXPECT_EQ((*table)['b'], 1 | pattern.unique_branch);
+  EXPECT_EQ((*table)['7'], 3 | pattern.unique_branch);
+
+  testPatternSuccess("a1", pattern, 1U);
+  testPatternSuccess("b12", pattern, 12U);
+  testPatternSuccess("cd3", pattern, 3U);
+  testPatternSuccess("7", pattern, 7U);
+  testPatternFailure<unsigned int>("c3", pattern);
+  testPatternFailure<unsigned int>("x", pattern);
+  testPatternFailure<unsigned int>("", pattern);
+}
+
+TEST(test_alternative, dispatch_overlap) {
+  // Both childs can start with 'a', so they must still be tried in order.
+  auto pattern = (lit("ab") >> uint_) | (lit('a') >> uint_) | uint_;
+
+  testPatternSuccess("ab1", pattern, 1U);
+  testPatternSuccess("a2", pattern, 2U);
+  testPatternSuccess("3", pattern, 3U);
+  testPatternFailure<unsigned int>("b3", pattern);
+}
+
+TEST(test_alternative, dispatch_nullable) {
+  // The second child can match without consuming anything, so it can never
+  // be ruled out.
+  auto pattern = (lit('a') >> uint_) | (*lit(' ') >> uint_);
+
+  testPatternSuccess("a1", pattern, 1U);
+  testPatternSuccess("  2", pattern, 2U);
+  testPatternSuccess("3", pattern, 3U);
+  testPatternFailure<unsigned int>("a", pattern);
+  testPatternFailure<unsigned int>("b", pattern);
+}
+
+TEST(test_alternative, dispatch_with_skipper) {
+  auto pattern =
+      apply_skipper((lit('a') >> uint_) | (lit('b') >> uint_), lit(' '));
+
+  testPatternSuccess(" a 1", pattern, 1U);
+  testPatternSuccess("  b 2", pattern, 2U);
+  testPatternFailure<unsigned int>(" c 3", pattern);
+}
@@ -0,0 +1,53 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+#include "test_utils.h"
+
+#include <string>
+#include <vector>
+
+using namespace abu;
+
+namespace {
+template <typename PAT_T>
+constexpr bool is_direct = !DirectParser<PAT_T>::IS_COROUTINE;
+}  // namespace
+
+TEST(test_direct, selection) {
+  static_assert(is_direct<decltype(uint_ >> ',' >> uint_)>);
+  static_assert(is_direct<decltype(*(uint_ >> ';'))>);
+  static_assert(is_direct<decltype(uint_ % ',')>);
+  static_assert(!is_direct<decltype(uint_)>);
+  static_assert(!is_direct<decltype(*char_('a', 'z'))>);
+}
+
+TEST(test_direct, mixed_with_coroutines) {
+  // Symbol and Operators only have coroutine parsers.
+  auto key = symbol(std::map<std::string, int>{{"a", 1}, {"b", 2}});
+  auto sum = operators<char>(uint_, {{Assoc::LEFT, {{"+", '+'}}}},
+                             [](char, int l, int r) { return l + r; });
+  auto pattern = +(key >> '=' >> sum >> ';');
+
+  std::vector<std::tuple<int, int>> expected{{1, 3}, {2, 4}};
+  testPatternSuccess("a=1+2;b=4;", pattern, expected);
+  testPatternFailure<decltype(expected)>("a=1+;", pattern);
+}
+
+TEST(test_direct, deep_recursion) {
+  RecurMemoryPool pool;
+  Recur<struct nest_t> nest(pool);
+  ABU_Recur_define(nest, nest_t, -('(' >> nest >> ')'));
+  auto pattern = nest >> eoi;
+
+  std::string data = std::string(200, '(') + std::string(200, ')');
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern));
+
+  data.pop_back();
+  EXPECT_EQ(Result::FAILURE, parse(data.begin(), data.end(), pattern));
+}
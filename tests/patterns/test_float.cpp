@@ -0,0 +1,90 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+
+#include "gtest/gtest.h"
+#include "test_utils.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace abu;
+
+TEST(test_float, test_default_pattern) {
+  testPatternSuccess("12", double_, 12.0);
+  testPatternSuccess("1.5", double_, 1.5);
+  testPatternSuccess("-0.25", double_, -0.25);
+  testPatternSuccess("+3", double_, 3.0);
+  testPatternSuccess("1.", double_, 1.0);
+  testPatternSuccess(".5", double_, 0.5);
+  testPatternSuccess("1e3", double_, 1000.0);
+  testPatternSuccess("1E-2", double_, 0.01);
+  testPatternSuccess("2.5e+1", double_, 25.0);
+
+  testPatternFailure<double>("", double_);
+  testPatternFailure<double>("-", double_);
+  testPatternFailure<double>(".", double_);
+  testPatternFailure<double>("e5", double_);
+  testPatternFailure<double>("abc", double_);
+}
+
+TEST(test_float, test_dangling_exponent) {
+  // An exponent marker without digits is left in the stream.
+  testPatternSuccess("1.5e", double_ >> 'e', 1.5);
+  testPatternSuccess("2.5e+x", double_ >> lit("e+x"), 2.5);
+}
+
+TEST(test_float, test_rounding) {
+  testPatternSuccess("0.1", double_, 0.1);
+  testPatternSuccess("0.1", float_, 0.1f);
+  testPatternSuccess("3.14159265358979323846264338327950288", double_,
+                     3.14159265358979323846264338327950288);
+  testPatternSuccess("1.7976931348623157e308", double_,
+                     std::numeric_limits<double>::max());
+  testPatternSuccess("2.2250738585072014e-308", double_,
+                     std::numeric_limits<double>::min());
+  testPatternSuccess("4.9406564584124654e-324", double_,
+                     std::numeric_limits<double>::denorm_min());
+  testPatternSuccess("1e400", double_, std::numeric_limits<double>::infinity());
+  testPatternSuccess("1e-400", double_, 0.0);
+
+  // Exactly halfway between two doubles: ties to even.
+  testPatternSuccess("9007199254740993", double_, 9007199254740992.0);
+
+  // Just above halfway, which is only visible past the 19th digit.
+  testPatternSuccess("9007199254740993.0000000000000000001", double_,
+                     9007199254740994.0);
+}
+
+// Halfway cases that need every digit to be settled exactly.
+TEST(test_float, test_many_digits) {
+  // 2^-1075, halfway between 0 and the smallest subnormal.
+  std::string half_denorm =
+    "2.470328229206232720882843964341106861825299013071623822127928412503"
+    "37753635104375932649918180817996189898282347722858865463328355177969"
+    "89819938739800539093906315035659515570226392290858392449105184435931"
+    "80284993653615250031937045767824921936562366986365848075700158576926"
+    "99037063119282795585513329278343384093519780155312465972635795746227"
+    "66465272827220056374006485499977096599470454020828166226237857393450"
+    "73633900796776193057750674017632467360096895134053553745851666113422"
+    "37666786041621596804619144672918403005300575308490487653917113865916"
+    "46239524912623653881879636239373280423891018672348497668235089863388"
+    "58792562830275599565752445550725518931369083625477918694866799496832"
+    "40497058210285131854513962138377228261454376934125320985913276672363"
+    "28125";
+
+  testPatternSuccess(half_denorm + "e-324", double_, 0.0);
+  testPatternSuccess(half_denorm + "1e-324", double_,
+                     std::numeric_limits<double>::denorm_min());
+
+  // 1 + 2^-24, halfway between 1 and the next float.
+  testPatternSuccess("1.000000059604644775390625", float_, 1.0f);
+  testPatternSuccess("1.0000000596046447753906250001", float_,
+                     std::nextafter(1.0f, 2.0f));
+  testPatternSuccess("10000000596046447753906249999e-28", float_, 1.0f);
+}
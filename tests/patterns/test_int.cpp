@@ -21,3 +21,28 @@ TEST(test_int, test_default_pattern) {
   testPatternFailure<int>("", pattern);
   testPatternFailure<int>("a123", pattern);
 }
+
+TEST(test_int, test_long_values) {
+  testPatternSuccess("-1234567890123", int_, std::int64_t(-1234567890123LL));
+  testPatternSuccess("+1234567890123", int_, std::int64_t(1234567890123LL));
+  testPatternSuccess("-2147483648", int_, std::numeric_limits<int>::min());
+  testPatternSuccess("2147483647", int_, std::numeric_limits<int>::max());
+  testPatternSuccess("-9223372036854775808", int_,
+                     std::numeric_limits<std::int64_t>::min());
+  testPatternSuccess("-7fffffffF", Int<16>(), std::int64_t(-0x7FFFFFFFFLL));
+}
+
+template <typename T>
+Result parse_into(std::string const& data) {
+  T dst = 0;
+  return parse(data.begin(), data.end(), int_, dst);
+}
+
+TEST(test_int, test_overflow) {
+  EXPECT_EQ(Result::FAILURE, parse_into<int>("2147483648"));
+  EXPECT_EQ(Result::FAILURE, parse_into<int>("-2147483649"));
+  EXPECT_EQ(Result::FAILURE, parse_into<std::int8_t>("-129"));
+  EXPECT_EQ(Result::SUCCESS, parse_into<std::int8_t>("-128"));
+  EXPECT_EQ(Result::FAILURE, parse_into<std::int64_t>("9223372036854775808"));
+  EXPECT_EQ(Result::FAILURE, parse_into<std::int64_t>("-9223372036854775809"));
+}
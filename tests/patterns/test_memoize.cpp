@@ -0,0 +1,152 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+#include "test_utils.h"
+
+using namespace abu;
+
+TEST(test_memoize, simple_test) {
+  MemoCache cache;
+  auto pattern = memoize(uint_, cache);
+
+  testPatternSuccess("12", pattern, 12U);
+  testPatternFailure<unsigned int>("a", pattern);
+}
+
+TEST(test_memoize, replays_outcomes) {
+  MemoCache cache;
+  auto num = memoize(uint_, cache);
+  auto pattern = (num >> 'a') | (num >> 'b') | (num >> 'c');
+
+  std::string data = "12c";
+  unsigned int dst = 0;
+  auto status = parse(data.begin(), data.end(), pattern, dst);
+  EXPECT_EQ(status, Result::SUCCESS);
+  EXPECT_EQ(dst, 12U);
+  EXPECT_EQ(cache.misses(), 1U);
+  EXPECT_EQ(cache.hits(), 2U);
+
+  // Failures are remembered as well.
+  MemoCache fail_cache;
+  auto three_digits = memoize(UInt<10, 3, 3>(), fail_cache);
+  auto fail_pattern = (three_digits >> 'a') | (three_digits >> 'b');
+  data = "12b";
+  status = parse(data.begin(), data.end(), fail_pattern, dst);
+  EXPECT_EQ(status, Result::FAILURE);
+  EXPECT_EQ(fail_cache.misses(), 1U);
+  EXPECT_EQ(fail_cache.hits(), 1U);
+}
+
+TEST(test_memoize, same_rule_different_dst) {
+  MemoCache cache;
+  auto num = memoize(uint_, cache);
+  auto pattern = (discard(num) >> 'b') | num;
+
+  testPatternSuccess("12b", pattern, 0U);
+  testPatternSuccess("12", pattern, 12U);
+}
+
+TEST(test_memoize, backtracking_is_linear) {
+  // Every level of nesting tries term three times, which is exponential
+  // without memoization.
+  MemoCache cache;
+  RecurMemoryPool pool;
+  Recur<struct expr_t> expr(pool);
+
+  auto term = memoize(('(' >> expr >> ')') | uint_, cache);
+  auto expr_pat = (term >> '+' >> expr) | (term >> '-' >> expr) | term;
+  ABU_Recur_define(expr, expr_t, expr_pat);
+
+  std::size_t depth = 40;
+  std::string data = std::string(depth, '(') + "1" + std::string(depth, ')');
+  auto status = parse(data.begin(), data.end(), expr);
+  EXPECT_EQ(status, Result::SUCCESS);
+  EXPECT_LE(cache.misses(), 2 * (depth + 1));
+  EXPECT_GE(cache.hits(), 2 * depth);
+
+  data = "(1+2)-((3))+" + std::string(depth, '(') + "4" +
+         std::string(depth, ')');
+  EXPECT_EQ(parse(data.begin(), data.end(), expr), Result::SUCCESS);
+
+  data = std::string(depth, '(') + "1" + std::string(depth - 1, ')');
+  EXPECT_EQ(parse(data.begin(), data.end(), expr), Result::FAILURE);
+}
+
+TEST(test_memoize, memory_budget) {
+  MemoCache cache(256);
+  auto num = memoize(uint_, cache);
+  auto pattern = ((num >> 'a') | (num >> ',')) % ' ';
+
+  std::string data = "1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,";
+  std::vector<unsigned int> dst;
+  auto status = parse(data.begin(), data.end(), pattern, dst);
+  EXPECT_EQ(status, Result::SUCCESS);
+  EXPECT_EQ(dst.size(), 14U);
+  EXPECT_EQ(dst.back(), 14U);
+  EXPECT_LE(cache.memory_used(), cache.memory_budget());
+  EXPECT_GT(cache.flushes(), 0U);
+}
+
+TEST(test_memoize, reused_buffer) {
+  MemoCache cache;
+  auto num = memoize(uint_, cache);
+
+  std::string data = "12";
+  unsigned int dst = 0;
+  EXPECT_EQ(parse(data.begin(), data.end(), num, dst), Result::SUCCESS);
+  EXPECT_EQ(dst, 12U);
+
+  // Same memory, same length, different content.
+  data[0] = '3';
+  data[1] = '4';
+  EXPECT_EQ(parse(data.begin(), data.end(), num, dst), Result::SUCCESS);
+  EXPECT_EQ(dst, 34U);
+
+  auto parser = make_reusable_parser<unsigned int>(num);
+  data[0] = '5';
+  EXPECT_EQ(parser.parse(data.begin(), data.end(), dst), Result::SUCCESS);
+  EXPECT_EQ(dst, 54U);
+  data[1] = '6';
+  EXPECT_EQ(parser.parse(data.begin(), data.end(), dst), Result::SUCCESS);
+  EXPECT_EQ(dst, 56U);
+}
+
+TEST(test_memoize, collection_values) {
+  std::vector<unsigned int> values(1000, 7);
+  EXPECT_GE(memo_value_size(values), 1000 * sizeof(unsigned int));
+
+  std::vector<std::string> strings(10, std::string(100, 'x'));
+  EXPECT_GE(memo_value_size(strings), 1000U);
+
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += std::to_string(i) + ",";
+  }
+  data += "1000;";
+
+  // Every value of the list is replayed.
+  MemoCache large_cache;
+  auto large_num = memoize(uint_ % ',', large_cache);
+  std::vector<unsigned int> dst;
+  EXPECT_EQ(parse(data.begin(), data.end(), large_num >> ';', dst),
+            Result::SUCCESS);
+  EXPECT_EQ(dst.size(), 1001U);
+  EXPECT_EQ(dst.back(), 1000U);
+  EXPECT_GE(large_cache.memory_used(), 1001 * sizeof(unsigned int));
+
+  // Whereas it does not fit in this one at all.
+  MemoCache small_cache(1024);
+  auto small_num = memoize(uint_ % ',', small_cache);
+  dst.clear();
+  EXPECT_EQ(parse(data.begin(), data.end(), small_num >> ';', dst),
+            Result::SUCCESS);
+  EXPECT_EQ(dst.size(), 1001U);
+  EXPECT_GT(small_cache.flushes(), 0U);
+  EXPECT_EQ(small_cache.size(), 0U);
+}
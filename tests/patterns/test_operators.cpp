@@ -0,0 +1,125 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+#include "test_utils.h"
+
+#include <functional>
+
+using namespace abu;
+
+namespace {
+int combine(char op, int lhs, int rhs) {
+  switch (op) {
+    case '+':
+      return lhs + rhs;
+    case '-':
+      return lhs - rhs;
+    case '*':
+      return lhs * rhs;
+    case '/':
+      return lhs / rhs;
+    case '^': {
+      int result = 1;
+      for (int i = 0; i < rhs; ++i) {
+        result *= lhs;
+      }
+      return result;
+    }
+  }
+  return 0;
+}
+
+auto arithmetic() {
+  return operators<char>(uint_,
+                         {{Assoc::LEFT, {{"+", '+'}, {"-", '-'}}},
+                          {Assoc::LEFT, {{"*", '*'}, {"/", '/'}}},
+                          {Assoc::RIGHT, {{"^", '^'}}}},
+                         combine);
+}
+}  // namespace
+
+TEST(test_operators, single_operand) {
+  auto pattern = arithmetic();
+
+  testPatternSuccess("12", pattern, 12);
+  testPatternFailure<int>("a", pattern);
+  testPatternFailure<int>("+1", pattern);
+}
+
+TEST(test_operators, precedence) {
+  auto pattern = arithmetic();
+
+  testPatternSuccess("1+2*3", pattern, 7);
+  testPatternSuccess("2*3+4", pattern, 10);
+  testPatternSuccess("1+2*3^2-4", pattern, 15);
+  testPatternSuccess("2*3^2*2", pattern, 36);
+}
+
+TEST(test_operators, associativity) {
+  auto pattern = arithmetic();
+
+  testPatternSuccess("8-3-2", pattern, 3);
+  testPatternSuccess("64/4/2", pattern, 8);
+  testPatternSuccess("2^3^2", pattern, 512);
+}
+
+TEST(test_operators, dangling_operator) {
+  // The trailing operator is given back, so that the rest of the pattern can
+  // match it.
+  auto pattern = arithmetic() >> '+';
+
+  testPatternSuccess("1+2*3+", pattern, 7);
+  testPatternFailure<int>("1+2*", pattern);
+}
+
+TEST(test_operators, longest_token) {
+  auto pattern = operators<char>(uint_,
+                                 {{Assoc::LEFT, {{"*", '*'}}},
+                                  {Assoc::RIGHT, {{"**", '^'}}}},
+                                 combine);
+
+  testPatternSuccess("2*3**2", pattern, 18);
+}
+
+TEST(test_operators, callable_table) {
+  using op_t = std::function<int(int, int)>;
+  auto pattern = operators<op_t>(
+      uint_, {{Assoc::LEFT, {{"+", std::plus<int>()}}},
+              {Assoc::LEFT, {{"*", std::multiplies<int>()}}}});
+
+  testPatternSuccess("2+3*4", pattern, 14);
+}
+
+TEST(test_operators, recursive) {
+  RecurMemoryPool pool;
+  Recur<struct expr_t, int> expr(pool);
+  auto primary = int_ | ('(' >> expr >> ')');
+  ABU_Recur_define(expr, expr_t, operators<char>(primary,
+                                                 {{Assoc::LEFT, {{"-", '-'}}},
+                                                  {Assoc::LEFT, {{"*", '*'}}}},
+                                                 combine));
+
+  testPatternSuccess("(1-2)*3", expr, -3);
+  testPatternSuccess("1-(2-(3*2))", expr, 5);
+  testPatternFailure<int>("(1-2", expr);
+}
+
+TEST(test_operators, with_skipper) {
+  auto pattern = apply_skipper(arithmetic() >> ';', lit(' '));
+
+  testPatternSuccess(" 1 + 2 * 3 ;", pattern, 7);
+  testPatternSuccess("2 ^3 ^ 2;", pattern, 512);
+}
+
+TEST(test_operators, first_set) {
+  auto fs = first_set(arithmetic());
+  EXPECT_FALSE(fs.nullable);
+  EXPECT_TRUE(fs.accepts('7'));
+  EXPECT_FALSE(fs.accepts('+'));
+}
@@ -0,0 +1,127 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+#include "test_utils.h"
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+using namespace abu;
+
+TEST(test_optimize, fuse_literals) {
+  auto pattern = optimize(lit('a') >> 'b' >> "cd" >> uint_ >> 'e' >> 'f');
+
+  static_assert(std::is_same<decltype(pattern),
+                             Seq<StringLiteral<char>, UInt<10, 1, 0>,
+                                 StringLiteral<char>>>::value);
+
+  testPatternSuccess("abcd12ef", pattern, 12);
+  testPatternFailure<int>("abc12ef", pattern);
+  testPatternFailure<int>("abcd12e", pattern);
+}
+
+TEST(test_optimize, remove_pass) {
+  auto pattern = optimize(pass >> uint_ >> pass >> ',' >> uint_);
+
+  static_assert(std::tuple_size<std::decay_t<decltype(
+                    pattern.childs())>>::value == 3);
+
+  testPatternSuccess("1,2", pattern, std::make_tuple(1, 2));
+}
+
+TEST(test_optimize, flatten) {
+  auto pattern = optimize(seq(uint_, seq(lit(','), uint_)));
+  static_assert(std::is_same<decltype(pattern),
+                             Seq<UInt<10, 1, 0>, CharLiteral<char>,
+                                 UInt<10, 1, 0>>>::value);
+
+  testPatternSuccess("1,2", pattern, std::make_tuple(1, 2));
+
+  // Lifting this one would change the destination.
+  auto nested = optimize(seq(uint_, seq(lit(','), uint_, lit(','), uint_)));
+  static_assert(std::tuple_size<std::decay_t<decltype(
+                    nested.childs())>>::value == 2);
+
+  auto choice = optimize(alt(lit("ab"), alt(lit("cd"), lit("ef"))));
+  static_assert(std::tuple_size<std::decay_t<decltype(
+                    choice.childs())>>::value == 3);
+
+  testPatternSuccess("ef", choice, nil);
+}
+
+TEST(test_optimize, merge_chars) {
+  auto pattern = optimize(char_('a') | char_('b') | char_("xyz"));
+  static_assert(std::is_same<decltype(pattern),
+                             Char<char_set::Compiled<char>>>::value);
+
+  testPatternSuccess("a", pattern, 'a');
+  testPatternSuccess("y", pattern, 'y');
+  testPatternFailure<char>("c", pattern);
+
+  // Only neighbours are merged, the order of the alternatives matters.
+  auto mixed = optimize(char_('a') | uint_ | char_('b') | char_('c'));
+  static_assert(std::tuple_size<std::decay_t<decltype(
+                    mixed.childs())>>::value == 3);
+
+  testPatternSuccess("c", *mixed, std::vector<int>{'c'});
+  testPatternSuccess("12", *mixed, std::vector<int>{12});
+}
+
+TEST(test_optimize, collapse_repeats) {
+  auto plus = optimize(+(+lit('a')));
+  static_assert(
+      std::is_same<decltype(plus), Repeat<CharLiteral<char>, 1, 0>>::value);
+  testPatternSuccess("aaa", plus, nil);
+  testPatternFailure<Nil>("", plus);
+
+  auto star = optimize(*(+lit('a')) >> 'b');
+  static_assert(std::is_same<std::tuple_element_t<0, std::decay_t<decltype(
+                                 star.childs())>>,
+                             Repeat<CharLiteral<char>, 0, 0>>::value);
+  testPatternSuccess("aab", star, nil);
+  testPatternSuccess("b", star, nil);
+
+  // The values of uint_ are grouped by the inner repetition.
+  auto values = optimize(+(+uint_));
+  static_assert(
+      std::is_same<decltype(values),
+                   Repeat<Repeat<UInt<10, 1, 0>, 1, 0>, 1, 0>>::value);
+}
+
+TEST(test_optimize, respects_skipper) {
+  auto pattern = optimize(apply_skipper(lit('a') >> 'b' >> uint_, lit(' ')));
+
+  testPatternSuccess("a b 12", pattern, 12);
+  testPatternSuccess(" ab 12", pattern, 12);
+
+  // Inside a lexeme, the skipper is not active anymore.
+  auto tight = optimize(
+      apply_skipper(lexeme(lit('a') >> 'b') >> uint_, lit(' ')));
+
+  testPatternSuccess("ab 12", tight, 12);
+  testPatternFailure<int>("a b 12", tight);
+
+  auto repeats = optimize(apply_skipper(+(+lit('a')), lit(' ')));
+  using repeats_t = std::decay_t<decltype(repeats.getChild())>;
+  static_assert(std::is_same<repeats_t, Repeat<Repeat<CharLiteral<char>, 1, 0>,
+                                               1, 0>>::value);
+  testPatternSuccess("a a a", repeats, nil);
+}
+
+TEST(test_optimize, actions) {
+  int count = 0;
+  auto pattern =
+      optimize(*((lit('a') >> 'b')[([&]() { ++count; })] | lit('c')));
+
+  std::string data = "abcab";
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern));
+  EXPECT_EQ(count, 2);
+}
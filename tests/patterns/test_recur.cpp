@@ -131,3 +131,49 @@ TEST(test_recur, recur_delegate_to_template) {
 
   testPatternSuccess("12", as_recur(pat, pool), 12);
 }
+
+TEST(test_recur, deep_nesting) {
+  RecurMemoryPool pool;
+  Recur<struct nested_t> nested(pool);
+
+  ABU_Recur_define(nested, nested_t, ('(' >> nested >> ')') | lit('x'));
+
+  std::size_t depth = 500;
+  auto data = std::string(depth, '(') + "x" + std::string(depth, ')');
+  testPatternSuccess(data, nested, nil);
+  testPatternFailure<Nil>(data.substr(0, data.size() - 1), nested);
+}
+
+TEST(test_recur, arena_reuse) {
+  Arena arena(64);
+
+  // Allocations with stack-like lifetimes keep reusing the same memory.
+  void* a = arena.allocate(48, 8);
+  arena.deallocate(a, 48);
+  EXPECT_EQ(arena.allocate(48, 8), a);
+
+  // Objects spill over to new blocks, and are destroyed on release.
+  int destroyed = 0;
+  struct Counted {
+    int* count;
+    ~Counted() { ++*count; }
+  };
+  for (int i = 0; i < 100; ++i) {
+    arena.create<Counted>(Counted{&destroyed});
+  }
+  destroyed = 0;
+  std::size_t blocks = arena.block_count();
+  EXPECT_GT(blocks, 1U);
+
+  arena.release();
+  EXPECT_EQ(destroyed, 100);
+
+  // Released blocks are reused.
+  for (int i = 0; i < 100; ++i) {
+    arena.allocate(sizeof(Counted), alignof(Counted));
+  }
+  EXPECT_EQ(arena.block_count(), blocks);
+
+  auto big = static_cast<char*>(arena.allocate(100000, 64));
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 64, 0U);
+}
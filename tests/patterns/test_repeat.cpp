@@ -78,4 +78,48 @@ TEST(test_repeat, test_chained_repeat_with_min_double) {
   EXPECT_EQ(status, result::SUCCESS);
   EXPECT_EQ("aabbcc", dst);
 }
-*/
\ No newline at end of file
+*/
+TEST(test_repeat, char_run) {
+  auto ident = char_set::range('a', 'z') | char_set::range('0', '9') | '_';
+  auto pattern = *char_(ident);
+
+  std::string long_ident(100, 'a');
+  long_ident[70] = '_';
+  long_ident[85] = '9';
+
+  testPatternSuccess(long_ident, pattern, long_ident);
+  testPatternSuccess(long_ident + " abc", pattern >> ' ' >> *char_(ident),
+                     long_ident + "abc");
+
+  std::string with_high_bytes = "abc\xE9" "def";
+  testPatternSuccess(with_high_bytes, pattern >> *char_(), with_high_bytes);
+}
+
+TEST(test_repeat, char_run_bounds) {
+  auto digits = char_set::range('0', '9') | '.';
+
+  testPatternSuccess("1234567", repeat<2, 4>(char_(digits)) >> *char_(),
+                     std::string("1234567"));
+  testPatternFailure<std::string>("1a", repeat<2, 4>(char_(digits)));
+
+  std::string data(40, '1');
+  std::string dst;
+  EXPECT_EQ(Result::SUCCESS,
+            parse(data.begin(), data.end(), repeat<0, 33>(char_(digits)), dst));
+  EXPECT_EQ(33U, dst.size());
+}
+
+TEST(test_repeat, child_is_reset) {
+  // The child parser is reused for every element, so none of its buffered
+  // state may leak from one element to the next.
+  auto pattern = *(+char_('a', 'z') >> ';');
+
+  testPatternSuccess("ab;cde;f;", pattern,
+                     std::vector<std::string>{"ab", "cde", "f"});
+
+  RecurMemoryPool pool;
+  Recur<struct nested_t, int> nested(pool);
+  ABU_Recur_define(nested, nested_t, uint_ | ('(' >> nested >> ')'));
+  testPatternSuccess("1;(2);((3));", *(nested >> ';'),
+                     std::vector<int>{1, 2, 3});
+}
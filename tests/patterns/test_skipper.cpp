@@ -37,3 +37,56 @@ TEST(test_skipper, cpp_comment) {
   testPatternSuccess("4, 5, 6", pattern, std::vector<int>{4, 5, 6});
   testPatternSuccess(" 7 , 8 , 9 ", pattern, std::vector<int>{7, 8, 9});
 }
+
+TEST(test_skipper, char_set_skippers) {
+  auto space = char_(" \t\n");
+
+  static_assert(skip_char_set<decltype(space)>::value);
+  static_assert(skip_char_set<decltype(lit(' '))>::value);
+  static_assert(skip_char_set<decltype(*space)>::value);
+  static_assert(!skip_char_set<decltype(repeat<2, 2>(space))>::value);
+  static_assert(!skip_char_set<decltype(space | lit("//"))>::value);
+
+  auto merged = optimize(apply_skipper(uint_, lit(' ') | '\t')).getSkip();
+  static_assert(skip_char_set<decltype(merged)>::value);
+
+  std::vector<int> expected = {1, 2, 3};
+  testPatternSuccess(" 1,\t2 ,\n\n 3 ", apply_skipper(uint_ % ',', space),
+                     expected);
+  testPatternSuccess(" 1,\t2 ,\n\n 3 ", apply_skipper(uint_ % ',', *space),
+                     expected);
+  testPatternSuccess("1,  2,3", apply_skipper(uint_ % ',', lit(' ')),
+                     expected);
+
+  // A skipper that eats two spaces at a time leaves odd ones behind.
+  auto pairs = apply_skipper(uint_ % ',', repeat<2, 2>(lit(' ')));
+  testPatternSuccess("1,  2,3", pairs, expected);
+  testPatternFailure<std::vector<int>>("1,   2,3", pairs >> eoi);
+}
+
+TEST(test_skipper, sequences) {
+  // Only the children of a sequence skip, not the sequence itself.
+  auto pattern =
+      apply_skipper(lit('(') >> uint_ >> ',' >> uint_ >> ')', char_(" "));
+
+  using pat_t = std::decay_t<decltype(pattern.getChild())>;
+  static_assert(skips_in_childs<pat_t>::value);
+
+  testPatternSuccess("( 1 ,2 )", pattern, std::make_tuple(1, 2));
+  testPatternSuccess("(1,2)", pattern, std::make_tuple(1, 2));
+  testPatternFailure<std::tuple<int, int>>("( 1 2 )", pattern);
+}
+
+TEST(test_skipper, lexemes) {
+  // A lexeme emits whatever its child emits.
+  auto word = lexeme(+char_("ab"));
+  static_assert(ParserFactory<decltype(word)>::dst_behavior() ==
+                DstBehavior::VALUE);
+  static_assert(ParserFactory<decltype(lexeme(lit('a')))>::dst_behavior() ==
+                DstBehavior::IGNORE);
+
+  auto pattern = apply_skipper(word >> ',' >> word, char_(" "));
+  testPatternSuccess(" ab , ba", pattern,
+                     std::make_tuple(std::string("ab"), std::string("ba")));
+  testPatternFailure<std::tuple<std::string, std::string>>("a b,ab", pattern);
+}
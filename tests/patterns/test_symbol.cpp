@@ -36,3 +36,85 @@ TEST(test_symbol, edge_cases) {
   testPatternSuccess("ba", pattern, 2);
   testPatternFailure<int>("longe", pattern);
 }
+
+TEST(test_symbol, large_table) {
+  // Enough symbols to have dense and sparse nodes at every level.
+  std::map<std::string, int> symbols;
+  int next_val = 0;
+  for (char a = 'a'; a <= 'z'; ++a) {
+    for (char b = 'a'; b <= 'z'; b += 3) {
+      symbols[std::string{a, b}] = next_val++;
+      symbols[std::string{a, b, '_', a}] = next_val++;
+    }
+  }
+  symbols["\xff\x80"] = next_val++;
+
+  auto pattern = symbol(symbols);
+  for (auto const& entry : symbols) {
+    testPatternSuccess(entry.first, pattern, entry.second);
+  }
+
+  // Longest match wins, and partial matches fall back to the last hit.
+  testPatternSuccess("ad_a", pattern, symbols["ad_a"]);
+  testPatternSuccess("ad_b", pattern, symbols["ad"]);
+  testPatternFailure<int>("ab", pattern);
+  testPatternFailure<int>("\xff", pattern);
+}
+
+TEST(test_symbol, wide_chars) {
+  std::map<std::u32string, int> symbols{
+      {U"été", 1}, {U"é", 2}, {U"hiver", 3}};
+
+  auto pattern = symbol(symbols);
+
+  std::u32string data = U"été";
+  int dst = 0;
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern, dst));
+  EXPECT_EQ(1, dst);
+
+  data = U"éte";
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern, dst));
+  EXPECT_EQ(2, dst);
+}
+
+TEST(test_symbol_hashed, simple_test) {
+  std::map<std::string, int> verbs{
+      {"GET", 1}, {"POST", 2}, {"PUT", 3}, {"DELETE", 4}, {"OPTIONS", 5}};
+
+  auto pattern = symbol_hashed(verbs, ' ');
+
+  testPatternSuccess("GET", pattern, 1);
+  testPatternSuccess("POST /index.html", pattern, 2);
+  testPatternSuccess("DELETE /", pattern >> lit(" /"), 4);
+  testPatternSuccess("OPTIONS", pattern, 5);
+
+  // The whole token must be a key.
+  testPatternFailure<int>("GE", pattern);
+  testPatternFailure<int>("GETS", pattern);
+  testPatternFailure<int>("OPTIONSS", pattern);
+  testPatternFailure<int>(" GET", pattern);
+}
+
+TEST(test_symbol_hashed, char_set_terminator) {
+  std::map<std::string, int> headers{{"Host", 1}, {"Accept", 2}};
+
+  auto pattern = symbol_hashed(headers, char_set::set(": "));
+  testPatternSuccess("Host: a", pattern >> ':', 1);
+  testPatternSuccess("Accept :", pattern >> ' ', 2);
+}
+
+TEST(test_symbol_hashed, large_table) {
+  std::map<std::string, int> symbols;
+  for (int i = 0; i < 3000; ++i) {
+    symbols["kw" + std::to_string(i * 7919)] = i;
+  }
+
+  auto pattern = symbol_hashed(symbols, ' ');
+  for (auto const& entry : symbols) {
+    std::string data = entry.first + " ";
+    int dst = -1;
+    EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern, dst));
+    EXPECT_EQ(entry.second, dst);
+  }
+  testPatternFailure<int>("kw1", pattern);
+}
@@ -52,5 +52,46 @@ TEST(test_uint, test_max_digits) {
   testPatternSuccess("1234", pattern, 123U);
 
   // make sure that the stream is in the right place once we reached the end
-  // testPatternSuccess("1234", pattern >> '4', 123U);
+  testPatternSuccess("1234", pattern >> '4', 123U);
+}
+
+TEST(test_uint, test_long_values) {
+  // Long enough to go through the grouped digit conversion.
+  testPatternSuccess("1234567890123", uint_, std::uint64_t(1234567890123ULL));
+  testPatternSuccess("00000000000000000042", uint_, std::uint64_t(42));
+  testPatternSuccess("123456789a", uint_, std::uint64_t(123456789));
+  testPatternSuccess("18446744073709551615", uint_,
+                     std::numeric_limits<std::uint64_t>::max());
+
+  testPatternSuccess("DeadBeef01", UInt<16>(), std::uint64_t(0xDEADBEEF01ULL));
+  testPatternSuccess("0123456789abcdefg", UInt<16>(),
+                     std::uint64_t(0x0123456789ABCDEFULL));
+  testPatternSuccess("1234567890", UInt<10, 1, 9>(), std::uint64_t(123456789));
+}
+
+TEST(test_uint, test_overflow) {
+  std::string data = "4294967296";
+
+  std::uint32_t small_dst = 0;
+  EXPECT_EQ(Result::FAILURE, parse(data.begin(), data.end(), uint_, small_dst));
+
+  std::uint64_t large_dst = 0;
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), uint_, large_dst));
+  EXPECT_EQ(4294967296ULL, large_dst);
+
+  std::uint8_t byte_dst = 0;
+  std::string byte_data = "256";
+  EXPECT_EQ(Result::FAILURE,
+            parse(byte_data.begin(), byte_data.end(), uint_, byte_dst));
+
+  data = "18446744073709551616";
+  EXPECT_EQ(Result::FAILURE, parse(data.begin(), data.end(), uint_, large_dst));
+
+  // Overflow is also detected when data is fed incrementally.
+  small_dst = 0;
+  auto parser = make_parser<std::string>(uint_, small_dst);
+  parser.data().add_buffer("42949");
+  EXPECT_EQ(Result::PARTIAL, parser.consume());
+  parser.data().add_buffer("67296", IsFinal::FINAL);
+  EXPECT_EQ(Result::FAILURE, parser.consume());
 }
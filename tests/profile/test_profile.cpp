@@ -0,0 +1,90 @@
+//  Copyright 2017 Francois Chabot
+//  (francois.chabot.dev@gmail.com)
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "abulafia/abulafia.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace abu;
+
+static_assert(profiling_enabled);
+
+TEST(test_profile, counts) {
+  profile_reset();
+
+  auto value = uint_;
+  auto pattern = value % ',';
+  auto& entry = profile_entry<decltype(value)>();
+
+  std::string data = "1,22,333,";
+  std::vector<unsigned int> dst;
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern, dst));
+
+  EXPECT_EQ(entry.calls, 4u);
+  EXPECT_EQ(entry.successes, 3u);
+  EXPECT_EQ(entry.failures, 1u);
+  EXPECT_EQ(entry.partials, 0u);
+  EXPECT_EQ(entry.bytes, 6u);
+
+  auto& list_entry = profile_entry<decltype(pattern)>();
+  EXPECT_EQ(list_entry.calls, 1u);
+  EXPECT_EQ(list_entry.bytes, 8u);
+  EXPECT_GE(list_entry.total_ns, entry.total_ns);
+}
+
+TEST(test_profile, rollbacks) {
+  profile_reset();
+
+  auto word = lit("abc");
+  auto pattern = *(word | (lit('a') >> 'b' >> 'd'));
+  auto& entry = profile_entry<decltype(word)>();
+
+  std::string data = "abcabdabc";
+  EXPECT_EQ(Result::SUCCESS, parse(data.begin(), data.end(), pattern));
+
+  // The second and last attempts fail, and give back what they read.
+  EXPECT_EQ(entry.calls, 4u);
+  EXPECT_EQ(entry.failures, 2u);
+  EXPECT_EQ(entry.rollbacks, 2u);
+}
+
+TEST(test_profile, resumable) {
+  profile_reset();
+
+  auto pattern = *(uint_ >> ';');
+  auto& entry = profile_entry<decltype(uint_)>();
+
+  auto parser = make_parser<std::string>(pattern);
+  parser.data().add_buffer("12");
+  EXPECT_EQ(Result::PARTIAL, parser.consume());
+  parser.data().add_buffer("3;4;", IsFinal::FINAL);
+  EXPECT_EQ(Result::SUCCESS, parser.consume());
+
+  EXPECT_EQ(entry.calls, 3u);
+  EXPECT_EQ(entry.successes, 2u);
+  EXPECT_GE(entry.partials, 1u);
+}
+
+TEST(test_profile, report) {
+  profile_reset();
+
+  std::string data = "12";
+  parse(data.begin(), data.end(), uint_);
+
+  std::ostringstream out;
+  profile_report(out);
+
+  auto report = out.str();
+  EXPECT_EQ(report.front(), '[');
+  EXPECT_NE(report.find("\"pattern\": \"abu::UInt<10, 1, 0>\""),
+            std::string::npos);
+  EXPECT_NE(report.find("\"calls\": 1,"), std::string::npos);
+  EXPECT_NE(report.find("\"bytes\": 2,"), std::string::npos);
+}